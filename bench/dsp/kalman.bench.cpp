@@ -0,0 +1,77 @@
+#include "emblib/dsp/kalman.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <string>
+
+/**
+ * Name of the matrix backend, set by each executable these benchmarks are built into
+ */
+#ifndef EMBLIB_BENCH_BACKEND
+#define EMBLIB_BENCH_BACKEND "unknown"
+#endif
+
+using emblib::math::matrixf;
+using emblib::math::vectorf;
+
+namespace {
+
+constexpr float DT = 0.01f;
+constexpr size_t WARMUP_STEPS = 100;
+
+/**
+ * Linear model where each state is the derivative of the previous one,
+ * and the first `OBS_DIM` states are observed
+ */
+template <size_t STATE_DIM, size_t OBS_DIM>
+void benchmark_kalman()
+{
+    matrixf<STATE_DIM> F = matrixf<STATE_DIM>::diagonal();
+    for (size_t i = 0; i + 1 < STATE_DIM; i++)
+        F(i, i + 1) = DT;
+    const matrixf<STATE_DIM> Q = matrixf<STATE_DIM>::diagonal(1e-4f);
+
+    matrixf<OBS_DIM, STATE_DIM> H(0);
+    for (size_t i = 0; i < OBS_DIM; i++)
+        H(i, i) = 1;
+    const matrixf<OBS_DIM> R = matrixf<OBS_DIM>::diagonal(1e-2f);
+    const vectorf<OBS_DIM> z(1);
+
+    auto f = [&F](const vectorf<STATE_DIM>& state) { return vectorf<STATE_DIM>(F.matmul(state)); };
+    auto Fj = [&F](const vectorf<STATE_DIM>&) { return F; };
+    auto h = [&H](const vectorf<STATE_DIM>& state) { return vectorf<OBS_DIM>(H.matmul(state)); };
+    auto Hj = [&H](const vectorf<STATE_DIM>&) { return H; };
+
+    // Covariance close to the steady state, so every step does the same work
+    emblib::dsp::kalman<STATE_DIM> filter;
+    for (size_t i = 0; i < WARMUP_STEPS; i++) {
+        filter.predict(f, Fj, Q);
+        filter.template update<OBS_DIM>(h, Hj, R, z);
+    }
+
+    const std::string suffix = " " + std::to_string(STATE_DIM) + " states, "
+        + std::to_string(OBS_DIM) + " observations (" EMBLIB_BENCH_BACKEND ")";
+
+    // Steps run on a copy, so the filter stays the same between iterations
+    BENCHMARK("kalman predict" + suffix)
+    {
+        auto step = filter;
+        step.predict(f, Fj, Q);
+        return step.get_state()(0);
+    };
+
+    BENCHMARK("kalman update" + suffix)
+    {
+        auto step = filter;
+        step.template update<OBS_DIM>(h, Hj, R, z);
+        return step.get_state()(0);
+    };
+}
+
+}
+
+TEST_CASE("Kalman filter step", "[dsp][kalman][!benchmark]")
+{
+    benchmark_kalman<4, 2>();
+    benchmark_kalman<9, 3>();
+    benchmark_kalman<15, 6>();
+}
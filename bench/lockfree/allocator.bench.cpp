@@ -0,0 +1,73 @@
+#include "emblib/lockfree/allocator.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using message_t = uint8_t[64];
+
+constexpr size_t POOL_SIZE = 4096;
+constexpr size_t OPERATION_COUNT = 1'000'000;
+// Number of blocks each thread holds at once
+constexpr size_t HELD_COUNT = 8;
+
+using allocator_t = emblib::lockfree::allocator<message_t, POOL_SIZE>;
+
+/**
+ * Allocate and deallocate `HELD_COUNT` blocks at a time
+ */
+template <typename allocator_type>
+void churn(allocator_type& allocator, size_t iterations)
+{
+    message_t* ptrs[HELD_COUNT];
+    for (size_t i = 0; i < iterations; i++) {
+        for (auto& ptr : ptrs) {
+            while ((ptr = allocator.alloc()) == nullptr) {}
+        }
+        for (auto& ptr : ptrs) {
+            allocator.dealloc(ptr);
+        }
+    }
+}
+
+}
+
+TEST_CASE("Allocator thread scaling", "[lockfree][allocator][!benchmark]")
+{
+    static allocator_t allocator;
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        const size_t iterations = OPERATION_COUNT / HELD_COUNT / threads;
+        const std::string suffix = "1M alloc/dealloc, " + std::to_string(threads) + " thread(s)";
+
+        BENCHMARK("shared free list " + suffix)
+        {
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < threads; t++) {
+                workers.emplace_back([iterations] { churn(allocator, iterations); });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        };
+
+        BENCHMARK("per-thread magazines " + suffix)
+        {
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < threads; t++) {
+                workers.emplace_back([iterations] {
+                    allocator_t::magazine<32> magazine(allocator);
+                    churn(magazine, iterations);
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        };
+    }
+}
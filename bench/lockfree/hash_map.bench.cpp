@@ -0,0 +1,96 @@
+#include "emblib/lockfree/hash_map.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr size_t KEY_COUNT = 256;
+constexpr size_t LOOKUP_COUNT = 1'000'000;
+
+/**
+ * Baseline map where all readers are serialized by a spinlock
+ */
+class locked_map {
+public:
+    void insert(uint16_t key, uint32_t value)
+    {
+        std::lock_guard lock(m_lock);
+        m_map[key] = value;
+    }
+
+    bool find(uint16_t key, uint32_t& value)
+    {
+        std::lock_guard lock(m_lock);
+        auto it = m_map.find(key);
+        if (it == m_map.end())
+            return false;
+        value = it->second;
+        return true;
+    }
+
+private:
+    emblib::rtos::spinlock m_lock;
+    std::unordered_map<uint16_t, uint32_t> m_map;
+};
+
+/**
+ * Each reader thread looks up `LOOKUP_COUNT` keys
+ */
+template <typename map_type>
+uint32_t run_readers(map_type& map, size_t thread_count)
+{
+    std::atomic<uint32_t> checksum{0};
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&map, &checksum, t] {
+            uint32_t sum = 0;
+            uint32_t value;
+            for (size_t i = 0; i < LOOKUP_COUNT; i++) {
+                if (map.find(static_cast<uint16_t>((i * 7 + t) % KEY_COUNT), value))
+                    sum += value;
+            }
+            checksum += sum;
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return checksum;
+}
+
+}
+
+TEST_CASE("Hash map reader scaling", "[lockfree][hash_map][!benchmark]")
+{
+    static emblib::lockfree::hash_map<uint16_t, uint32_t, 512> map;
+    static locked_map baseline;
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (uint16_t key = 0; key < KEY_COUNT; key++) {
+        map.insert(key, key);
+        baseline.insert(key, key);
+    }
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        const std::string suffix = "1M lookups per thread, " + std::to_string(threads) + " reader(s)";
+
+        BENCHMARK("lockfree::hash_map " + suffix)
+        {
+            return run_readers(map, threads);
+        };
+
+        BENCHMARK("rtos::spinlock + std::unordered_map " + suffix)
+        {
+            return run_readers(baseline, threads);
+        };
+    }
+}
@@ -0,0 +1,87 @@
+#include "emblib/lockfree/seqlock_cell.hpp"
+#include "emblib/lockfree/triple_buffer.hpp"
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+
+namespace {
+
+/**
+ * Same size as a quaternion with a timestamp
+ */
+struct attitude {
+    float values[4];
+    uint64_t timestamp;
+};
+
+/**
+ * Runs a writer thread publishing new values for its lifetime
+ */
+template <typename write_fn>
+class background_writer {
+public:
+    explicit background_writer(write_fn write) :
+        m_running(true),
+        m_thread([this, write] {
+            for (uint64_t i = 0; m_running.load(std::memory_order_relaxed); i++) {
+                write(attitude {{1, 0, 0, 0}, i});
+            }
+        })
+    {}
+
+    ~background_writer()
+    {
+        m_running = false;
+        m_thread.join();
+    }
+
+private:
+    std::atomic<bool> m_running;
+    std::thread m_thread;
+};
+
+}
+
+TEST_CASE("Latest value read latency", "[lockfree][triple_buffer][seqlock_cell][!benchmark]")
+{
+    SECTION("triple_buffer")
+    {
+        emblib::lockfree::triple_buffer<attitude> buffer;
+        background_writer writer([&buffer](const attitude& value) { buffer.write(value); });
+
+        BENCHMARK("triple_buffer read under writes")
+        {
+            return buffer.read().timestamp;
+        };
+    }
+
+    SECTION("seqlock_cell")
+    {
+        emblib::lockfree::seqlock_cell<attitude> cell;
+        background_writer writer([&cell](const attitude& value) { cell.write(value); });
+
+        BENCHMARK("seqlock_cell read under writes")
+        {
+            return cell.read().timestamp;
+        };
+    }
+
+    SECTION("spinlock")
+    {
+        emblib::rtos::spinlock lock;
+        attitude shared{};
+        background_writer writer([&](const attitude& value) {
+            emblib::rtos::scoped_lock guard(lock);
+            shared = value;
+        });
+
+        BENCHMARK("spinlock read under writes")
+        {
+            emblib::rtos::scoped_lock guard(lock);
+            return shared.timestamp;
+        };
+    }
+}
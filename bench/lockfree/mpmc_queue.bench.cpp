@@ -0,0 +1,96 @@
+#include "emblib/lockfree/mpmc_queue.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t QUEUE_SIZE = 1024;
+constexpr size_t ITEM_COUNT = 1'000'000;
+
+/**
+ * Baseline bounded queue using the standard library
+ */
+class mutex_queue {
+public:
+    bool push(size_t item)
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_queue.size() == QUEUE_SIZE)
+            return false;
+        m_queue.push_back(item);
+        return true;
+    }
+
+    bool pop(size_t& item)
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_queue.empty())
+            return false;
+        item = m_queue.front();
+        m_queue.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::deque<size_t> m_queue;
+};
+
+/**
+ * Move `ITEM_COUNT` items through the queue using
+ * `thread_count` producers and as many consumers
+ */
+template <typename queue_type>
+void run_workers(queue_type& queue, size_t thread_count)
+{
+    const size_t per_thread = ITEM_COUNT / thread_count;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&queue, per_thread] {
+            for (size_t sent = 0; sent < per_thread;) {
+                sent += queue.push(sent);
+            }
+        });
+        // Each consumer takes as many items as a producer sends, so no shared count is needed
+        threads.emplace_back([&queue, per_thread] {
+            size_t item;
+            for (size_t received = 0; received < per_thread;) {
+                received += queue.pop(item);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+}
+
+TEST_CASE("MPMC queue contention", "[lockfree][mpmc_queue][!benchmark]")
+{
+    static emblib::lockfree::mpmc_queue<size_t, QUEUE_SIZE> queue;
+    static mutex_queue baseline;
+    const size_t max_pairs = std::max(2u, std::thread::hardware_concurrency()) / 2;
+
+    for (size_t pairs = 1; pairs <= max_pairs; pairs *= 2) {
+        const std::string suffix = "1M items, " + std::to_string(pairs) + " producer/consumer pair(s)";
+
+        BENCHMARK("mpmc_queue " + suffix)
+        {
+            run_workers(queue, pairs);
+        };
+
+        BENCHMARK("std::mutex + std::deque " + suffix)
+        {
+            run_workers(baseline, pairs);
+        };
+    }
+}
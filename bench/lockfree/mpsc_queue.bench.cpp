@@ -0,0 +1,86 @@
+#include "emblib/lockfree/mpsc_queue.hpp"
+#include "emblib/lockfree/spsc_queue.hpp"
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t QUEUE_SIZE = 1024;
+constexpr size_t ITEM_COUNT = 1'000'000;
+
+/**
+ * Previous approach of sharing a single producer queue behind a lock
+ */
+class locked_queue {
+public:
+    bool push(size_t item) noexcept
+    {
+        emblib::rtos::scoped_lock lock(m_lock);
+        return m_queue.push(item);
+    }
+
+    bool pop(size_t& item) noexcept
+    {
+        return m_queue.pop(item);
+    }
+
+private:
+    emblib::rtos::spinlock m_lock;
+    emblib::lockfree::spsc_queue<size_t, QUEUE_SIZE> m_queue;
+};
+
+/**
+ * Push `ITEM_COUNT` items split between `producer_count` threads
+ * and pop all of them from the calling thread
+ */
+template <typename queue_type>
+void run_producers(queue_type& queue, size_t producer_count)
+{
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < producer_count; p++) {
+        producers.emplace_back([&queue, producer_count] {
+            for (size_t sent = 0; sent < ITEM_COUNT / producer_count;) {
+                sent += queue.push(sent);
+            }
+        });
+    }
+
+    size_t item;
+    const size_t total = ITEM_COUNT / producer_count * producer_count;
+    for (size_t received = 0; received < total;) {
+        received += queue.pop(item);
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
+
+}
+
+TEST_CASE("MPSC queue producer scaling", "[lockfree][mpsc_queue][!benchmark]")
+{
+    static emblib::lockfree::mpsc_queue<size_t, QUEUE_SIZE> queue;
+    static locked_queue spinlock_queue;
+    const size_t max_producers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+
+    for (size_t producers = 1; producers <= max_producers; producers *= 2) {
+        const std::string suffix = "1M items, " + std::to_string(producers) + " producer(s)";
+
+        BENCHMARK("mpsc_queue " + suffix)
+        {
+            run_producers(queue, producers);
+        };
+
+        BENCHMARK("spinlock + spsc_queue " + suffix)
+        {
+            run_producers(spinlock_queue, producers);
+        };
+    }
+}
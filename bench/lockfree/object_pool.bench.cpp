@@ -0,0 +1,89 @@
+#include "emblib/lockfree/object_pool.hpp"
+#include "emblib/lockfree/spsc_queue.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <array>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct payload {
+    size_t length;
+    uint8_t data[1024];
+};
+
+constexpr size_t CONSUMER_COUNT = 4;
+constexpr size_t QUEUE_SIZE = 64;
+constexpr size_t ITEM_COUNT = 100'000;
+
+using pool_t = emblib::lockfree::object_pool<payload, CONSUMER_COUNT * QUEUE_SIZE + 1>;
+
+/**
+ * Push every item into each of the consumer queues and
+ * let the consumer threads drain them
+ */
+template <typename item_type, typename produce_fn, typename consume_fn>
+void run_fan_out(produce_fn produce, consume_fn consume)
+{
+    static std::array<emblib::lockfree::spsc_queue<item_type, QUEUE_SIZE>, CONSUMER_COUNT> queues;
+
+    std::vector<std::thread> consumers;
+    for (auto& queue : queues) {
+        consumers.emplace_back([&queue, &consume] {
+            item_type item;
+            for (size_t received = 0; received < ITEM_COUNT;) {
+                if (queue.pop(item)) {
+                    consume(item);
+                    received++;
+                }
+            }
+        });
+    }
+
+    for (size_t i = 0; i < ITEM_COUNT; i++) {
+        produce(queues, i);
+    }
+
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+}
+
+}
+
+TEST_CASE("Object pool fan-out", "[lockfree][object_pool][!benchmark]")
+{
+    static pool_t pool;
+
+    BENCHMARK("100k 1 KiB payloads to 4 consumers, copies")
+    {
+        run_fan_out<payload>(
+            [](auto& queues, size_t i) {
+                payload item;
+                item.length = i;
+                for (auto& queue : queues) {
+                    while (!queue.push(item)) {}
+                }
+            },
+            [](const payload& item) { (void)item.length; }
+        );
+    };
+
+    BENCHMARK("100k 1 KiB payloads to 4 consumers, shared handles")
+    {
+        run_fan_out<payload*>(
+            [](auto& queues, size_t i) {
+                pool_t::shared_handle handle;
+                while (!(handle = pool.make_shared())) {}
+                handle->length = i;
+                for (auto& queue : queues) {
+                    auto copy = handle;
+                    while (!queue.push(copy.get())) {}
+                    copy.release();
+                }
+            },
+            [](payload* ptr) { pool.adopt_shared(ptr); }
+        );
+    };
+}
@@ -0,0 +1,69 @@
+#include "emblib/lockfree/spsc_queue.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <thread>
+
+namespace {
+
+struct sample {
+    float values[3];
+    uint32_t timestamp;
+};
+
+constexpr size_t QUEUE_SIZE = 1024;
+constexpr size_t BATCH_SIZE = 32;
+constexpr size_t ITEM_COUNT = 1'000'000;
+
+using queue_t = emblib::lockfree::spsc_queue<sample, QUEUE_SIZE>;
+
+/**
+ * Pop `ITEM_COUNT` items one at a time
+ */
+void consume_single(queue_t& queue)
+{
+    sample item;
+    for (size_t received = 0; received < ITEM_COUNT;) {
+        received += queue.pop(item);
+    }
+}
+
+/**
+ * Pop `ITEM_COUNT` items in batches
+ */
+void consume_batch(queue_t& queue)
+{
+    std::array<sample, BATCH_SIZE> items;
+    for (size_t received = 0; received < ITEM_COUNT;) {
+        received += queue.pop_n(items);
+    }
+}
+
+}
+
+TEST_CASE("SPSC queue throughput", "[lockfree][spsc_queue][!benchmark]")
+{
+    static queue_t queue;
+
+    BENCHMARK("1M items, single push/pop")
+    {
+        std::thread consumer(consume_single, std::ref(queue));
+        for (size_t sent = 0; sent < ITEM_COUNT;) {
+            sent += queue.push(sample{{1, 2, 3}, static_cast<uint32_t>(sent)});
+        }
+        consumer.join();
+    };
+
+    BENCHMARK("1M items, batched push/pop")
+    {
+        std::array<sample, BATCH_SIZE> items{};
+        std::thread consumer(consume_batch, std::ref(queue));
+        for (size_t sent = 0; sent < ITEM_COUNT;) {
+            const size_t count = std::min(BATCH_SIZE, ITEM_COUNT - sent);
+            sent += queue.push_n({items.data(), count});
+        }
+        consumer.join();
+    };
+}
@@ -0,0 +1,76 @@
+#include "emblib/math/matrix.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <string>
+
+/**
+ * Name of the matrix backend, set by each executable these benchmarks are built into
+ */
+#ifndef EMBLIB_BENCH_BACKEND
+#define EMBLIB_BENCH_BACKEND "unknown"
+#endif
+
+using emblib::math::matrixf;
+
+namespace {
+
+/**
+ * Well conditioned matrix with distinct elements
+ */
+template <size_t ROWS, size_t COLS = ROWS>
+matrixf<ROWS, COLS> make_matrix(float seed)
+{
+    matrixf<ROWS, COLS> result;
+    for (size_t row = 0; row < ROWS; row++) {
+        for (size_t col = 0; col < COLS; col++)
+            result(row, col) = (row == col ? ROWS : 0) + seed / (1 + row + 2 * col);
+    }
+    return result;
+}
+
+template <size_t DIM>
+void benchmark_operations()
+{
+    const matrixf<DIM> a = make_matrix<DIM>(1);
+    const matrixf<DIM> b = make_matrix<DIM>(2);
+    const std::string suffix = " " + std::to_string(DIM) + "x" + std::to_string(DIM) + " (" EMBLIB_BENCH_BACKEND ")";
+
+    BENCHMARK("add" + suffix)
+    {
+        return matrixf<DIM>(a + b);
+    };
+
+    BENCHMARK("element-wise mul" + suffix)
+    {
+        return matrixf<DIM>(a * b);
+    };
+
+    BENCHMARK("transpose" + suffix)
+    {
+        return matrixf<DIM>(a.transpose());
+    };
+
+    BENCHMARK("matmul" + suffix)
+    {
+        return matrixf<DIM>(a.matmul(b));
+    };
+
+    BENCHMARK("covariance propagation" + suffix)
+    {
+        return matrixf<DIM>(a.matmul(b).matmul(a.transpose()) + b);
+    };
+
+    BENCHMARK("solve" + suffix)
+    {
+        return matrixf<DIM>(b.matdivl(a));
+    };
+}
+
+}
+
+TEST_CASE("Matrix operations", "[math][matrix][!benchmark]")
+{
+    benchmark_operations<3>();
+    benchmark_operations<4>();
+    benchmark_operations<6>();
+}
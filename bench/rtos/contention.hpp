@@ -0,0 +1,167 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/**
+ * Thread counts to measure, the powers of two and the counts halfway between
+ * them below the number of hardware threads, which is always the last one
+ */
+inline std::vector<size_t> get_thread_counts()
+{
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<size_t> counts;
+
+    for (size_t threads = 1; threads < max_threads; threads *= 2) {
+        counts.push_back(threads);
+        if (threads >= 2 && threads + threads / 2 < max_threads) {
+            counts.push_back(threads + threads / 2);
+        }
+    }
+    counts.push_back(max_threads);
+    return counts;
+}
+
+/**
+ * Result of running threads contending for the same lock for a fixed time
+ */
+struct contention_s {
+    double ops_per_sec;
+    // Jain's index of the per thread acquisition counts, 1 if perfectly fair
+    // and 1/threads if a single thread got all the acquisitions
+    double fairness;
+    uint64_t min_ops;
+    uint64_t max_ops;
+};
+
+/**
+ * Each thread repeatedly acquires the lock and increments a shared counter
+ */
+template <typename lock_type>
+uint64_t run_fixed_ops(lock_type& lock, size_t thread_count, size_t ops_per_thread)
+{
+    uint64_t counter = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&lock, &counter, ops_per_thread] {
+            for (size_t i = 0; i < ops_per_thread; i++) {
+                lock.lock();
+                counter++;
+                lock.unlock();
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return counter;
+}
+
+/**
+ * Threads acquire the lock as often as they can for `duration`,
+ * and the acquisitions of each thread are counted
+ */
+template <typename lock_type>
+contention_s measure_contention(lock_type& lock, size_t thread_count, std::chrono::milliseconds duration)
+{
+    std::atomic<bool> running(true);
+    std::atomic<size_t> ready(0);
+    std::vector<uint64_t> ops(thread_count, 0);
+    uint64_t counter = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t] {
+            uint64_t local = 0;
+            ready++;
+            while (ready.load() != thread_count) {}
+
+            while (running.load(std::memory_order_relaxed)) {
+                lock.lock();
+                counter++;
+                lock.unlock();
+                local++;
+            }
+            ops[t] = local;
+        });
+    }
+
+    while (ready.load() != thread_count) {}
+    const auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(duration);
+    running.store(false, std::memory_order_relaxed);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    double sum = 0;
+    double sum_squares = 0;
+    for (const uint64_t count : ops) {
+        sum += count;
+        sum_squares += double(count) * count;
+    }
+
+    return {
+        sum / elapsed.count(),
+        sum_squares > 0 ? sum * sum / (thread_count * sum_squares) : 1.0,
+        *std::min_element(ops.begin(), ops.end()),
+        *std::max_element(ops.begin(), ops.end())
+    };
+}
+
+/**
+ * Percentiles of the time threads waited to acquire the lock
+ */
+struct wait_latency_s {
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p99;
+    std::chrono::nanoseconds p999;
+    std::chrono::nanoseconds max;
+};
+
+/**
+ * Each thread acquires the lock `ops_per_thread` times, measuring every wait
+ */
+template <typename lock_type>
+wait_latency_s measure_wait_latency(lock_type& lock, size_t thread_count, size_t ops_per_thread)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::atomic<size_t> ready(0);
+    std::vector<std::chrono::nanoseconds> samples(thread_count * ops_per_thread);
+    uint64_t counter = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t] {
+            ready++;
+            while (ready.load() != thread_count) {}
+
+            for (size_t i = 0; i < ops_per_thread; i++) {
+                const auto start = clock::now();
+                lock.lock();
+                samples[t * ops_per_thread + i] = clock::now() - start;
+                counter++;
+                lock.unlock();
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const auto percentile = [&samples](double p) {
+        return samples[std::min(samples.size() - 1, size_t(p * samples.size()))];
+    };
+    return {percentile(0.5), percentile(0.99), percentile(0.999), samples.back()};
+}
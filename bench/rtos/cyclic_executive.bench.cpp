@@ -0,0 +1,135 @@
+#include "emblib/posix/monotonic_clock.hpp"
+#include "emblib/rtos/cyclic_executive.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::chrono::seconds RUN_TIME(2);
+
+/**
+ * Records how late each job started after the latest release of the ideal
+ * schedule, releases which were skipped show up in the number of jobs
+ */
+class jitter_probe {
+public:
+    jitter_probe(const emblib::rtos::clock& clock, std::chrono::nanoseconds period) :
+        m_clock(clock),
+        m_period(period)
+    {}
+
+    void start(std::chrono::nanoseconds time)
+    {
+        m_start = time;
+        m_samples.clear();
+        m_samples.reserve(RUN_TIME / m_period + 1);
+    }
+
+    void record() noexcept
+    {
+        const auto elapsed = m_clock.now() - m_start;
+        m_samples.push_back(elapsed % m_period);
+    }
+
+    void report(const std::string& name)
+    {
+        std::sort(m_samples.begin(), m_samples.end());
+        const auto percentile = [this](double p) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                m_samples[std::min(m_samples.size() - 1, size_t(p * m_samples.size()))]).count();
+        };
+        WARN(name << ": " << m_samples.size() << " of " << RUN_TIME / m_period << " jobs, jitter p50 " << percentile(0.5) << " us, p99 "
+             << percentile(0.99) << " us, p99.9 " << percentile(0.999) << " us, max "
+             << percentile(1.0) << " us");
+    }
+
+private:
+    const emblib::rtos::clock& m_clock;
+    std::chrono::nanoseconds m_period;
+    std::chrono::nanoseconds m_start{};
+    std::vector<std::chrono::nanoseconds> m_samples;
+};
+
+/**
+ * Simulated work of a task
+ */
+void spin_for(const emblib::rtos::clock& clock, std::chrono::nanoseconds duration)
+{
+    const auto end = clock.now() + duration;
+    while (clock.now() < end) {}
+}
+
+}
+
+TEST_CASE("Cyclic executive jitter", "[rtos][cyclic_executive][!benchmark]")
+{
+    emblib::posix::monotonic_clock clock;
+    emblib::rtos::cyclic_executive<3> executive(clock);
+
+    jitter_probe pid(clock, 1ms);
+    jitter_probe kalman(clock, 5ms);
+    jitter_probe telemetry(clock, 20ms);
+
+    auto pid_fn = [&] {
+        pid.record();
+        spin_for(clock, 50us);
+    };
+    auto kalman_fn = [&] {
+        kalman.record();
+        spin_for(clock, 200us);
+    };
+    auto telemetry_fn = [&] {
+        telemetry.record();
+        spin_for(clock, 300us);
+    };
+
+    const size_t pid_index = executive.add_task(pid_fn, 1ms);
+    const size_t kalman_index = executive.add_task(kalman_fn, 5ms);
+    const size_t telemetry_index = executive.add_task(telemetry_fn, 20ms);
+
+    std::thread stopper([&executive] {
+        std::this_thread::sleep_for(RUN_TIME);
+        executive.stop();
+    });
+
+    const auto start = clock.now();
+    pid.start(start);
+    kalman.start(start);
+    telemetry.start(start);
+    executive.run();
+    stopper.join();
+
+    pid.report("1 kHz PID");
+    kalman.report("200 Hz Kalman");
+    telemetry.report("50 Hz telemetry");
+
+    using stats_t = decltype(executive)::task_stats;
+    for (const size_t index : {pid_index, kalman_index, telemetry_index}) {
+        const stats_t& stats = executive.get_task_stats(index);
+        WARN("task " << index << ": " << stats.get_metrics().get(stats_t::DEADLINE_MISSES) << " deadline misses, "
+             << "max execution time " << stats.get_execution_time().get_max() / 1000 << " us");
+    }
+}
+
+TEST_CASE("Relative sleep loop jitter", "[rtos][cyclic_executive][!benchmark]")
+{
+    // Baseline of a hand-rolled loop, which drifts by the work and the wake up latency
+    emblib::posix::monotonic_clock clock;
+    jitter_probe pid(clock, 1ms);
+
+    const auto start = clock.now();
+    pid.start(start);
+    while (clock.now() - start < RUN_TIME) {
+        pid.record();
+        spin_for(clock, 50us);
+        std::this_thread::sleep_for(1ms);
+    }
+
+    pid.report("1 kHz PID with sleep_for");
+}
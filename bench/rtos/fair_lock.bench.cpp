@@ -0,0 +1,57 @@
+#include "contention.hpp"
+#include "emblib/rtos/mcs_lock.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "emblib/rtos/ticket_lock.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <string>
+
+namespace {
+
+constexpr size_t OPS_PER_THREAD = 100'000;
+constexpr size_t LATENCY_OPS_PER_THREAD = 20'000;
+
+template <typename lock_type>
+void report_wait_latency(const std::string& name, size_t threads)
+{
+    lock_type lock;
+    const wait_latency_s result = measure_wait_latency(lock, threads, LATENCY_OPS_PER_THREAD);
+    WARN(name << ", " << threads << " thread(s): wait p50 " << result.p50.count() << " ns, p99 "
+         << result.p99.count() << " ns, p99.9 " << result.p999.count() << " ns, max " << result.max.count() << " ns");
+}
+
+}
+
+TEST_CASE("Fair lock throughput", "[rtos][ticket_lock][mcs_lock][!benchmark]")
+{
+    for (const size_t threads : get_thread_counts()) {
+        const std::string suffix = "100k lock/unlock per thread, " + std::to_string(threads) + " thread(s)";
+
+        BENCHMARK("rtos::ticket_lock " + suffix)
+        {
+            static emblib::rtos::ticket_lock lock;
+            return run_fixed_ops(lock, threads, OPS_PER_THREAD);
+        };
+
+        BENCHMARK("rtos::mcs_lock " + suffix)
+        {
+            static emblib::rtos::mcs_lock lock;
+            return run_fixed_ops(lock, threads, OPS_PER_THREAD);
+        };
+
+        BENCHMARK("rtos::spinlock " + suffix)
+        {
+            static emblib::rtos::spinlock lock;
+            return run_fixed_ops(lock, threads, OPS_PER_THREAD);
+        };
+    }
+}
+
+TEST_CASE("Fair lock wait latency", "[rtos][ticket_lock][mcs_lock][!benchmark]")
+{
+    for (const size_t threads : get_thread_counts()) {
+        report_wait_latency<emblib::rtos::ticket_lock>("rtos::ticket_lock", threads);
+        report_wait_latency<emblib::rtos::mcs_lock>("rtos::mcs_lock", threads);
+        report_wait_latency<emblib::rtos::spinlock>("rtos::spinlock", threads);
+    }
+}
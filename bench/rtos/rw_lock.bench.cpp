@@ -0,0 +1,95 @@
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/rw_spinlock.hpp"
+#include "emblib/rtos/seqlock.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t READ_COUNT = 1'000'000;
+
+/**
+ * Calibration table read by the control loops
+ */
+struct table_s {
+    float values[16];
+};
+
+/**
+ * Each reader thread copies the table `READ_COUNT` times
+ */
+template <typename read_fn_type>
+uint32_t run_readers(size_t thread_count, read_fn_type read_fn)
+{
+    std::atomic<uint32_t> checksum{0};
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&read_fn, &checksum] {
+            float sum = 0;
+            for (size_t i = 0; i < READ_COUNT; i++) {
+                sum += read_fn().values[i % 16];
+            }
+            checksum += static_cast<uint32_t>(sum);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return checksum;
+}
+
+}
+
+TEST_CASE("Read-mostly lock reader scaling", "[rtos][rw_spinlock][seqlock][!benchmark]")
+{
+    static const table_s initial = {{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+    static emblib::rtos::seqlock<table_s> seqlock(initial);
+    static emblib::rtos::rw_spinlock rw_spinlock;
+    static emblib::rtos::spinlock spinlock;
+    static std::shared_mutex shared_mutex;
+    static table_s table = initial;
+
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        const std::string suffix = "1M reads per thread, " + std::to_string(threads) + " reader(s)";
+
+        BENCHMARK("rtos::seqlock " + suffix)
+        {
+            return run_readers(threads, [] { return seqlock.read(); });
+        };
+
+        BENCHMARK("rtos::rw_spinlock " + suffix)
+        {
+            return run_readers(threads, [] {
+                emblib::rtos::shared_lock lock(rw_spinlock);
+                return table;
+            });
+        };
+
+        BENCHMARK("rtos::spinlock " + suffix)
+        {
+            return run_readers(threads, [] {
+                emblib::rtos::scoped_lock lock(spinlock);
+                return table;
+            });
+        };
+
+        BENCHMARK("std::shared_mutex " + suffix)
+        {
+            return run_readers(threads, [] {
+                std::shared_lock lock(shared_mutex);
+                return table;
+            });
+        };
+    }
+}
@@ -0,0 +1,86 @@
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t OPS_PER_THREAD = 100'000;
+
+/**
+ * Half the threads lock the pair as (a, b) and the other half as (b, a)
+ */
+template <typename lock_pair_fn_type>
+uint64_t run_opposite_orders(size_t thread_count, lock_pair_fn_type lock_pair_fn)
+{
+    uint64_t counter = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&lock_pair_fn, &counter, t] {
+            for (size_t i = 0; i < OPS_PER_THREAD; i++) {
+                lock_pair_fn(t % 2 == 1, [&counter] { counter++; });
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return counter;
+}
+
+}
+
+TEST_CASE("Scoped lock opposite orders", "[rtos][lock][!benchmark]")
+{
+    static emblib::rtos::spinlock spin_a, spin_b;
+    static std::mutex mutex_a, mutex_b;
+
+    const size_t max_threads = std::max(2u, std::thread::hardware_concurrency());
+
+    for (size_t threads = 2; threads <= max_threads; threads *= 2) {
+        const std::string suffix = "100k pair locks per thread, " + std::to_string(threads) + " thread(s)";
+
+        BENCHMARK("rtos::scoped_lock<spinlock, spinlock> " + suffix)
+        {
+            return run_opposite_orders(threads, [](bool is_reversed, auto fn) {
+                if (is_reversed) {
+                    emblib::rtos::scoped_lock lock(spin_b, spin_a);
+                    fn();
+                } else {
+                    emblib::rtos::scoped_lock lock(spin_a, spin_b);
+                    fn();
+                }
+            });
+        };
+
+        BENCHMARK("std::scoped_lock<std::mutex, std::mutex> " + suffix)
+        {
+            return run_opposite_orders(threads, [](bool is_reversed, auto fn) {
+                if (is_reversed) {
+                    std::scoped_lock lock(mutex_b, mutex_a);
+                    fn();
+                } else {
+                    std::scoped_lock lock(mutex_a, mutex_b);
+                    fn();
+                }
+            });
+        };
+
+        // Baseline which avoids the dead-lock with a global lock order
+        BENCHMARK("spinlock pair in global order " + suffix)
+        {
+            return run_opposite_orders(threads, [](bool, auto fn) {
+                std::lock_guard lock_a(spin_a);
+                std::lock_guard lock_b(spin_b);
+                fn();
+            });
+        };
+    }
+}
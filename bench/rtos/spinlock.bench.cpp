@@ -0,0 +1,76 @@
+#include "contention.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace {
+
+constexpr size_t OPS_PER_THREAD = 100'000;
+constexpr std::chrono::milliseconds FAIRNESS_DURATION(200);
+
+/**
+ * Baseline lock which spins on the exchange itself
+ */
+class tas_spinlock {
+public:
+    void lock() noexcept
+    {
+        while (m_lock.exchange(true, std::memory_order_acquire)) {}
+    }
+
+    void unlock() noexcept
+    {
+        m_lock.store(false, std::memory_order_release);
+    }
+
+private:
+    std::atomic<bool> m_lock{false};
+};
+
+template <typename lock_type>
+void report_contention(const std::string& name, size_t threads)
+{
+    lock_type lock;
+    const contention_s result = measure_contention(lock, threads, FAIRNESS_DURATION);
+    WARN(name << ", " << threads << " thread(s): " << result.ops_per_sec << " ops/s, fairness "
+         << result.fairness << ", acquisitions per thread " << result.min_ops << " to " << result.max_ops);
+}
+
+}
+
+TEST_CASE("Spinlock contention", "[rtos][spinlock][!benchmark]")
+{
+    for (const size_t threads : get_thread_counts()) {
+        const std::string suffix = "100k lock/unlock per thread, " + std::to_string(threads) + " thread(s)";
+
+        BENCHMARK("rtos::spinlock " + suffix)
+        {
+            static emblib::rtos::spinlock lock;
+            return run_fixed_ops(lock, threads, OPS_PER_THREAD);
+        };
+
+        BENCHMARK("test-and-set spinlock " + suffix)
+        {
+            static tas_spinlock lock;
+            return run_fixed_ops(lock, threads, OPS_PER_THREAD);
+        };
+
+        BENCHMARK("std::mutex " + suffix)
+        {
+            static std::mutex lock;
+            return run_fixed_ops(lock, threads, OPS_PER_THREAD);
+        };
+    }
+}
+
+TEST_CASE("Spinlock fairness", "[rtos][spinlock][!benchmark]")
+{
+    for (const size_t threads : get_thread_counts()) {
+        report_contention<emblib::rtos::spinlock>("rtos::spinlock", threads);
+        report_contention<tas_spinlock>("test-and-set spinlock", threads);
+        report_contention<std::mutex>("std::mutex", threads);
+    }
+}
@@ -0,0 +1,146 @@
+#include "emblib/rtos/task_scheduler.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t WORKER_COUNT = 4;
+constexpr size_t ITEM_COUNT = 1'000'000;
+constexpr size_t GRAIN = 256;
+
+/**
+ * Baseline thread pool where all workers share a single locked task queue
+ */
+class shared_queue_pool {
+    struct task_s {
+        void (*fn)(void*, size_t, size_t);
+        void* arg;
+        size_t begin;
+        size_t end;
+        std::atomic<size_t>* pending;
+    };
+
+public:
+    explicit shared_queue_pool(size_t worker_count)
+    {
+        for (size_t i = 0; i < worker_count; i++) {
+            m_workers.emplace_back([this] {
+                task_s task;
+                while (pop(task, true)) {
+                    execute(task);
+                }
+            });
+        }
+    }
+
+    ~shared_queue_pool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_running = false;
+        }
+        m_cv.notify_all();
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    template <typename fn_type>
+    void parallel_for(size_t begin, size_t end, size_t grain, fn_type& fn)
+    {
+        auto call = [](void* arg, size_t chunk_begin, size_t chunk_end) {
+            (*static_cast<fn_type*>(arg))(chunk_begin, chunk_end);
+        };
+        std::atomic<size_t> pending(0);
+
+        for (size_t chunk_begin = begin; chunk_begin < end; chunk_begin += grain) {
+            pending++;
+            std::lock_guard lock(m_mutex);
+            m_tasks.push_back({call, &fn, chunk_begin, std::min(end, chunk_begin + grain), &pending});
+        }
+        m_cv.notify_all();
+
+        task_s task;
+        while (pending.load(std::memory_order_acquire) != 0) {
+            if (pop(task, false))
+                execute(task);
+        }
+    }
+
+private:
+    bool pop(task_s& task, bool wait)
+    {
+        std::unique_lock lock(m_mutex);
+        if (wait)
+            m_cv.wait(lock, [this] { return !m_tasks.empty() || !m_running; });
+        if (m_tasks.empty())
+            return false;
+        task = m_tasks.front();
+        m_tasks.pop_front();
+        return true;
+    }
+
+    static void execute(const task_s& task)
+    {
+        task.fn(task.arg, task.begin, task.end);
+        task.pending->fetch_sub(1, std::memory_order_release);
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<task_s> m_tasks;
+    std::vector<std::thread> m_workers;
+    bool m_running = true;
+};
+
+}
+
+TEST_CASE("Task scheduler parallel for", "[rtos][task_scheduler][!benchmark]")
+{
+    static std::vector<float> data(ITEM_COUNT, 1.0f);
+    const size_t worker_count = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, WORKER_COUNT);
+
+    auto scale = [](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            data[i] = data[i] * 0.5f + 1.0f;
+        }
+    };
+
+    {
+        // Calling thread takes part in the work, so one less worker is started
+        static emblib::rtos::task_scheduler<WORKER_COUNT, 8192, 8192> scheduler;
+        auto idle = [] { std::this_thread::yield(); };
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i + 1 < worker_count; i++) {
+            workers.emplace_back([&idle, i] { scheduler.run(i, idle); });
+        }
+
+        BENCHMARK("task_scheduler 1M items, grain " + std::to_string(GRAIN) + ", " + std::to_string(worker_count) + " thread(s)")
+        {
+            scheduler.parallel_for(0, ITEM_COUNT, GRAIN, scale);
+        };
+
+        scheduler.stop();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    {
+        shared_queue_pool pool(worker_count - 1);
+
+        BENCHMARK("shared std::mutex + std::deque pool 1M items, grain " + std::to_string(GRAIN) + ", " + std::to_string(worker_count) + " thread(s)")
+        {
+            pool.parallel_for(0, ITEM_COUNT, GRAIN, scale);
+        };
+    }
+}
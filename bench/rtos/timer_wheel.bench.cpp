@@ -0,0 +1,110 @@
+#include "emblib/rtos/timer_wheel.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr size_t TIMER_COUNT = 100'000;
+// Deadlines are spread over 10 seconds of 1ms ticks
+constexpr uint64_t MAX_DELAY = 10'000;
+
+using wheel_t = emblib::rtos::timer_wheel<TIMER_COUNT>;
+
+/**
+ * Baseline timer queue ordered by deadline
+ */
+class map_timers {
+public:
+    using handle = std::multimap<uint64_t, std::function<void()>>::iterator;
+
+    handle start(uint64_t delay, std::function<void()> cb)
+    {
+        return m_timers.emplace(m_now + delay, std::move(cb));
+    }
+
+    void cancel(handle timer)
+    {
+        m_timers.erase(timer);
+    }
+
+    void advance(uint64_t ticks)
+    {
+        m_now += ticks;
+        while (!m_timers.empty() && m_timers.begin()->first <= m_now) {
+            auto cb = std::move(m_timers.begin()->second);
+            m_timers.erase(m_timers.begin());
+            cb();
+        }
+    }
+
+private:
+    std::multimap<uint64_t, std::function<void()>> m_timers;
+    uint64_t m_now = 0;
+};
+
+std::vector<uint64_t> make_delays()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<uint64_t> dist(1, MAX_DELAY);
+    std::vector<uint64_t> delays(TIMER_COUNT);
+    for (auto& delay : delays) {
+        delay = dist(rng);
+    }
+    return delays;
+}
+
+}
+
+TEST_CASE("Timer wheel 100k concurrent timers", "[rtos][timer_wheel][!benchmark]")
+{
+    static wheel_t wheel;
+    static map_timers baseline;
+    static const std::vector<uint64_t> delays = make_delays();
+    static std::vector<wheel_t::handle> wheel_handles(TIMER_COUNT);
+    static std::vector<map_timers::handle> map_handles(TIMER_COUNT);
+    size_t fired = 0;
+    auto on_expire = [&fired] { fired++; };
+
+    BENCHMARK("timer_wheel start and expire 100k timers")
+    {
+        for (size_t i = 0; i < TIMER_COUNT; i++) {
+            wheel.start(delays[i], on_expire);
+        }
+        wheel.advance(MAX_DELAY);
+        return fired;
+    };
+
+    BENCHMARK("std::multimap start and expire 100k timers")
+    {
+        for (size_t i = 0; i < TIMER_COUNT; i++) {
+            baseline.start(delays[i], on_expire);
+        }
+        baseline.advance(MAX_DELAY);
+        return fired;
+    };
+
+    BENCHMARK("timer_wheel start and cancel 100k timers")
+    {
+        for (size_t i = 0; i < TIMER_COUNT; i++) {
+            wheel_handles[i] = wheel.start(delays[i], on_expire);
+        }
+        for (auto& timer : wheel_handles) {
+            wheel.cancel(timer);
+        }
+    };
+
+    BENCHMARK("std::multimap start and cancel 100k timers")
+    {
+        for (size_t i = 0; i < TIMER_COUNT; i++) {
+            map_handles[i] = baseline.start(delays[i], on_expire);
+        }
+        for (auto& timer : map_handles) {
+            baseline.cancel(timer);
+        }
+    };
+}
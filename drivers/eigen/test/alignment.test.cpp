@@ -0,0 +1,79 @@
+#include "emblib/dsp/kalman.hpp"
+#include "emblib/lockfree/allocator.hpp"
+#include "emblib/lockfree/mpmc_queue.hpp"
+#include "emblib/lockfree/object_pool.hpp"
+#include "emblib/lockfree/spsc_queue.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <cstdint>
+#include <memory>
+#include <new>
+
+using emblib::math::matrixf;
+using emblib::math::vectorf;
+
+namespace {
+
+template <typename data_type>
+bool is_aligned(const data_type* ptr)
+{
+    return reinterpret_cast<uintptr_t>(ptr) % alignof(data_type) == 0;
+}
+
+}
+
+// Wrappers and types holding them keep the alignment of the Eigen storage
+static_assert(alignof(matrixf<4>) == alignof(Eigen::Matrix4f));
+static_assert(alignof(vectorf<4>) == alignof(Eigen::Vector4f));
+static_assert(alignof(emblib::dsp::kalman<4>) >= alignof(Eigen::Matrix4f));
+
+TEST_CASE("Kalman filter alignment", "[eigen][alignment]")
+{
+    emblib::dsp::kalman<4> filters[3];
+    auto heap_filter = std::make_unique<emblib::dsp::kalman<4>>(vectorf<4>(1));
+
+    for (const auto& filter : filters) {
+        REQUIRE(is_aligned(&filter));
+        REQUIRE(is_aligned(&filter.get_state()));
+    }
+    REQUIRE(is_aligned(heap_filter.get()));
+    REQUIRE(is_aligned(&heap_filter->get_state()));
+}
+
+TEST_CASE("Lock-free container alignment", "[eigen][alignment]")
+{
+    // Eigen matrices are not trivially copyable, so queues carry raw elements
+    // with the same alignment, or pointers to blocks of an allocator
+    struct alignas(Eigen::Matrix4f) elements_s {
+        float values[16];
+    };
+
+    emblib::lockfree::mpmc_queue<elements_s, 4> mpmc_queue;
+    elements_s elements {};
+    for (size_t i = 0; i < 3; i++) {
+        elements.values[0] = float(i);
+        REQUIRE(mpmc_queue.push(elements));
+        REQUIRE(mpmc_queue.pop(elements));
+        REQUIRE(Eigen::Map<const Eigen::Matrix4f, Eigen::Aligned>(elements.values)(0, 0) == float(i));
+    }
+
+    emblib::lockfree::spsc_queue<elements_s, 4> spsc_queue;
+    for (size_t i = 0; i < 3; i++) {
+        REQUIRE(spsc_queue.push(elements));
+        const auto items = spsc_queue.peek(1);
+        REQUIRE(is_aligned(items.first.data()));
+        spsc_queue.release(1);
+    }
+
+    emblib::lockfree::allocator<matrixf<4>, 4> allocator;
+    for (size_t i = 0; i < 4; i++) {
+        matrixf<4>* matrix = allocator.alloc();
+        REQUIRE(is_aligned(matrix));
+        new (matrix) matrixf<4>(matrixf<4>::diagonal(2));
+    }
+
+    emblib::lockfree::object_pool<emblib::dsp::kalman<4>, 2> pool;
+    auto first = pool.make_unique();
+    auto second = pool.make_unique();
+    REQUIRE(is_aligned(first.get()));
+    REQUIRE(is_aligned(second.get()));
+}
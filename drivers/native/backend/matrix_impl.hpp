@@ -0,0 +1,278 @@
+#pragma once
+
+#include "emblib/math/matrix.hpp"
+
+namespace emblib::math {
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr matrix<scalar_type, ROWS, COLS, base_type>::matrix(scalar_type scalar) noexcept
+    : m_base(details::native_generate<ROWS, COLS>([scalar](size_t, size_t) { return scalar; }))
+{
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr matrix<scalar_type, ROWS, COLS, base_type>::matrix(std::initializer_list<std::initializer_list<scalar_type>> elements) noexcept
+    : m_base(elements)
+{
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <size_t TOP, size_t LEFT, size_t ROW_COUNT, size_t COL_COUNT>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::get_submatrix() noexcept
+{
+    static_assert((TOP + ROW_COUNT <= ROWS) && (LEFT + COL_COUNT <= COLS));
+    auto res = m_base.template block<ROW_COUNT, COL_COUNT>(TOP, LEFT);
+    return matrix<scalar_type, ROW_COUNT, COL_COUNT, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::transpose() const noexcept
+{
+    auto res = details::native_generate<COLS, ROWS>([this](size_t row, size_t col) { return m_base(col, row); });
+    return matrix<scalar_type, COLS, ROWS, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator+(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) + rhs(row, col); });
+    return matrix_same_t<decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator+(const scalar_type &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) + rhs; });
+    return matrix_same_t<decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::operator+=(const matrix_same_t<rhs_base> &rhs) noexcept
+{
+    details::native_for_each<ROWS, COLS>([this, &rhs](size_t row, size_t col) { m_base(row, col) += rhs(row, col); });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::operator+=(const scalar_type &rhs) noexcept
+{
+    details::native_for_each<ROWS, COLS>([this, &rhs](size_t row, size_t col) { m_base(row, col) += rhs; });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator-(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) - rhs(row, col); });
+    return matrix_same_t<decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator-(const scalar_type &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) - rhs; });
+    return matrix_same_t<decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::operator-=(const matrix_same_t<rhs_base> &rhs) noexcept
+{
+    details::native_for_each<ROWS, COLS>([this, &rhs](size_t row, size_t col) { m_base(row, col) -= rhs(row, col); });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::operator-=(const scalar_type &rhs) noexcept
+{
+    details::native_for_each<ROWS, COLS>([this, &rhs](size_t row, size_t col) { m_base(row, col) -= rhs; });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_scalar, typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator*(const matrix_similar_t<rhs_scalar, rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) * rhs(row, col); });
+    return matrix_similar_t<typename decltype(res)::scalar_t, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_scalar>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator*(const rhs_scalar &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) * rhs; });
+    return matrix_similar_t<typename decltype(res)::scalar_t, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::operator*=(const matrix_same_t<rhs_base> &rhs) noexcept
+{
+    // Only works if the result type is the same as the scalar type
+    static_assert(std::is_same_v<decltype(std::declval<scalar_type>() * std::declval<scalar_type>()), scalar_type>);
+    details::native_for_each<ROWS, COLS>([this, &rhs](size_t row, size_t col) { m_base(row, col) *= rhs(row, col); });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::operator*=(const scalar_type &rhs) noexcept
+{
+    // Only works if the result type is the same as the scalar type
+    static_assert(std::is_same_v<decltype(std::declval<scalar_type>() * std::declval<scalar_type>()), scalar_type>);
+    details::native_for_each<ROWS, COLS>([this, &rhs](size_t row, size_t col) { m_base(row, col) *= rhs; });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_scalar, typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator/(const matrix_similar_t<rhs_scalar, rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) / rhs(row, col); });
+    return matrix_similar_t<typename decltype(res)::scalar_t, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_scalar>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator/(const rhs_scalar &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) / rhs; });
+    return matrix_similar_t<typename decltype(res)::scalar_t, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::operator/=(const matrix_same_t<rhs_base> &rhs) noexcept
+{
+    // Only works if the result type is the same as the scalar type
+    static_assert(std::is_same_v<decltype(std::declval<scalar_type>() / std::declval<scalar_type>()), scalar_type>);
+    details::native_for_each<ROWS, COLS>([this, &rhs](size_t row, size_t col) { m_base(row, col) /= rhs(row, col); });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::operator/=(const scalar_type &rhs) noexcept
+{
+    // Only works if the result type is the same as the scalar type
+    static_assert(std::is_same_v<decltype(std::declval<scalar_type>() / std::declval<scalar_type>()), scalar_type>);
+    details::native_for_each<ROWS, COLS>([this, &rhs](size_t row, size_t col) { m_base(row, col) /= rhs; });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator-() const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this](size_t row, size_t col) { return -m_base(row, col); });
+    return matrix_same_t<decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator<(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) < rhs(row, col); });
+    return matrix_similar_t<bool, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator<=(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) <= rhs(row, col); });
+    return matrix_similar_t<bool, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator>(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) > rhs(row, col); });
+    return matrix_similar_t<bool, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator>=(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) >= rhs(row, col); });
+    return matrix_similar_t<bool, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator==(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) == rhs(row, col); });
+    return matrix_similar_t<bool, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator&&(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) && rhs(row, col); });
+    return matrix_similar_t<bool, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator||(const matrix_same_t<rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this, &rhs](size_t row, size_t col) { return m_base(row, col) || rhs(row, col); });
+    return matrix_similar_t<bool, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::operator!() const noexcept
+{
+    auto res = details::native_generate<ROWS, COLS>([this](size_t row, size_t col) { return !static_cast<bool>(m_base(row, col)); });
+    return matrix_similar_t<bool, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr bool matrix<scalar_type, ROWS, COLS, base_type>::all() const noexcept
+{
+    bool res = true;
+    details::native_for_each<ROWS, COLS>([this, &res](size_t row, size_t col) { res = res && static_cast<bool>(m_base(row, col)); });
+    return res;
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr bool matrix<scalar_type, ROWS, COLS, base_type>::any() const noexcept
+{
+    bool res = false;
+    details::native_for_each<ROWS, COLS>([this, &res](size_t row, size_t col) { res = res || static_cast<bool>(m_base(row, col)); });
+    return res;
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+constexpr void matrix<scalar_type, ROWS, COLS, base_type>::fill(scalar_type scalar) noexcept
+{
+    details::native_for_each<ROWS, COLS>([this, scalar](size_t row, size_t col) { m_base(row, col) = scalar; });
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <size_t RHS_COLS, typename rhs_scalar, typename rhs_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::matmul(const matrix<rhs_scalar, COLS, RHS_COLS, rhs_base> &rhs) const noexcept
+{
+    auto res = details::native_generate<ROWS, RHS_COLS>([this, &rhs](size_t row, size_t col) {
+        return details::native_sum<COLS>([this, &rhs, row, col](size_t i) { return m_base(row, i) * rhs(i, col); });
+    });
+    return matrix<typename decltype(res)::scalar_t, ROWS, RHS_COLS, decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename divisor_base>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::matdivl(const matrix<scalar_type, ROWS, ROWS, divisor_base> &divisor) const noexcept
+{
+    // Solving works in place, so it takes copies of both sides
+    auto res = details::native_solve(
+        details::native_generate<ROWS, ROWS>([&divisor](size_t row, size_t col) { return divisor(row, col); }),
+        details::native_generate<ROWS, COLS>([this](size_t row, size_t col) { return m_base(row, col); })
+    );
+    return matrix_same_t<decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <typename cast_type>
+constexpr auto matrix<scalar_type, ROWS, COLS, base_type>::cast_base() const noexcept
+{
+    return details::native_generate<ROWS, COLS>([this](size_t row, size_t col) { return static_cast<cast_type>(m_base(row, col)); });
+}
+
+}
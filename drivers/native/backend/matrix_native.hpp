@@ -0,0 +1,257 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+/**
+ * All matrix operations of this backend can be evaluated at compile time
+ */
+#define EMBLIB_MATRIX_CONSTEXPR constexpr
+
+namespace emblib::math::details {
+
+/**
+ * Loops with at most this many iterations are unrolled at compile time,
+ * which covers element-wise operations on matrices up to 8x8
+ */
+constexpr size_t NATIVE_MAX_UNROLL = 64;
+
+template <typename fn_type, size_t... INDICES>
+constexpr void native_unroll(fn_type& fn, std::index_sequence<INDICES...>) noexcept
+{
+    (fn(INDICES), ...);
+}
+
+template <typename fn_type, size_t FIRST, size_t... INDICES>
+constexpr auto native_unroll_sum(fn_type& fn, std::index_sequence<FIRST, INDICES...>) noexcept
+{
+    auto sum = fn(FIRST);
+    ((sum += fn(INDICES)), ...);
+    return sum;
+}
+
+/**
+ * Call `fn(i)` for every `i` in [0, COUNT)
+ */
+template <size_t COUNT, typename fn_type>
+constexpr void native_for(fn_type&& fn) noexcept
+{
+    if constexpr (COUNT <= NATIVE_MAX_UNROLL) {
+        native_unroll(fn, std::make_index_sequence<COUNT>());
+    } else {
+        for (size_t i = 0; i < COUNT; i++)
+            fn(i);
+    }
+}
+
+/**
+ * Call `fn(row, col)` for every element in row-major order
+ */
+template <size_t ROWS, size_t COLS, typename fn_type>
+constexpr void native_for_each(fn_type&& fn) noexcept
+{
+    native_for<ROWS * COLS>([&fn](size_t i) { fn(i / COLS, i % COLS); });
+}
+
+/**
+ * Sum of `fn(i)` for every `i` in [0, COUNT), added in order
+ */
+template <size_t COUNT, typename fn_type>
+constexpr auto native_sum(fn_type&& fn) noexcept
+{
+    static_assert(COUNT > 0);
+    if constexpr (COUNT <= NATIVE_MAX_UNROLL) {
+        return native_unroll_sum(fn, std::make_index_sequence<COUNT>());
+    } else {
+        auto sum = fn(0);
+        for (size_t i = 1; i < COUNT; i++)
+            sum += fn(i);
+        return sum;
+    }
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, size_t STRIDE>
+class native_block;
+
+/**
+ * Fixed size matrix stored by value in row-major order
+ */
+template <typename scalar_type, size_t ROWS, size_t COLS>
+class native_matrix {
+    static_assert(ROWS > 0 && COLS > 0);
+
+public:
+    using scalar_t = scalar_type;
+
+public:
+    /**
+     * All elements are value initialized
+     */
+    constexpr native_matrix() noexcept :
+        m_data{}
+    {}
+
+    /**
+     * Rows of elements, where a single row initializes a column vector
+     * @note Elements which are not provided are value initialized
+     */
+    constexpr native_matrix(std::initializer_list<std::initializer_list<scalar_type>> elements) noexcept :
+        m_data{}
+    {
+        const bool is_column = COLS == 1 && elements.size() == 1;
+        size_t row = 0;
+
+        for (const auto& row_elements : elements) {
+            size_t col = 0;
+            for (const auto& element : row_elements) {
+                if (is_column && col < ROWS)
+                    (*this)(col, 0) = element;
+                else if (!is_column && row < ROWS && col < COLS)
+                    (*this)(row, col) = element;
+                col++;
+            }
+            row++;
+        }
+    }
+
+    /**
+     * Copy the elements of a block
+     */
+    template <size_t STRIDE>
+    constexpr native_matrix(const native_block<scalar_type, ROWS, COLS, STRIDE>& block) noexcept :
+        m_data{}
+    {
+        native_for_each<ROWS, COLS>([this, &block](size_t row, size_t col) {
+            (*this)(row, col) = block(row, col);
+        });
+    }
+
+    constexpr scalar_type operator()(size_t row, size_t col) const noexcept
+    {
+        return m_data[row * COLS + col];
+    }
+
+    constexpr scalar_type& operator()(size_t row, size_t col) noexcept
+    {
+        return m_data[row * COLS + col];
+    }
+
+    /**
+     * Get a writable reference to a part of the matrix
+     */
+    template <size_t ROW_COUNT, size_t COL_COUNT>
+    constexpr auto block(size_t top, size_t left) noexcept
+    {
+        return native_block<scalar_type, ROW_COUNT, COL_COUNT, COLS>(&m_data[top * COLS + left]);
+    }
+
+private:
+    std::array<scalar_type, ROWS * COLS> m_data;
+};
+
+/**
+ * Reference to a part of a native matrix, `STRIDE` is
+ * the number of columns of the referenced matrix
+ */
+template <typename scalar_type, size_t ROWS, size_t COLS, size_t STRIDE>
+class native_block {
+public:
+    using scalar_t = scalar_type;
+
+public:
+    constexpr explicit native_block(scalar_type* data) noexcept :
+        m_data(data)
+    {}
+
+    constexpr scalar_type operator()(size_t row, size_t col) const noexcept
+    {
+        return m_data[row * STRIDE + col];
+    }
+
+    constexpr scalar_type& operator()(size_t row, size_t col) noexcept
+    {
+        return m_data[row * STRIDE + col];
+    }
+
+    template <size_t ROW_COUNT, size_t COL_COUNT>
+    constexpr auto block(size_t top, size_t left) noexcept
+    {
+        return native_block<scalar_type, ROW_COUNT, COL_COUNT, STRIDE>(&m_data[top * STRIDE + left]);
+    }
+
+private:
+    scalar_type* m_data;
+};
+
+/**
+ * Create a matrix with elements `fn(row, col)`
+ */
+template <size_t ROWS, size_t COLS, typename fn_type>
+constexpr auto native_generate(fn_type&& fn) noexcept
+{
+    using scalar_t = std::decay_t<decltype(fn(size_t(0), size_t(0)))>;
+    native_matrix<scalar_t, ROWS, COLS> result;
+    native_for_each<ROWS, COLS>([&result, &fn](size_t row, size_t col) {
+        result(row, col) = fn(row, col);
+    });
+    return result;
+}
+
+/**
+ * Solve `lhs * x = rhs` using Gaussian elimination with partial pivoting
+ * @note Left hand side should be invertible
+ */
+template <typename scalar_type, size_t ROWS, size_t COLS>
+constexpr native_matrix<scalar_type, ROWS, COLS> native_solve(
+    native_matrix<scalar_type, ROWS, ROWS> lhs,
+    native_matrix<scalar_type, ROWS, COLS> rhs
+) noexcept
+{
+    auto abs = [](scalar_type value) { return value < scalar_type(0) ? -value : value; };
+
+    for (size_t k = 0; k < ROWS; k++) {
+        size_t pivot = k;
+        for (size_t row = k + 1; row < ROWS; row++) {
+            if (abs(lhs(row, k)) > abs(lhs(pivot, k)))
+                pivot = row;
+        }
+
+        if (pivot != k) {
+            native_for<ROWS>([&lhs, pivot, k](size_t col) {
+                const scalar_type temp = lhs(k, col);
+                lhs(k, col) = lhs(pivot, col);
+                lhs(pivot, col) = temp;
+            });
+            native_for<COLS>([&rhs, pivot, k](size_t col) {
+                const scalar_type temp = rhs(k, col);
+                rhs(k, col) = rhs(pivot, col);
+                rhs(pivot, col) = temp;
+            });
+        }
+
+        for (size_t row = k + 1; row < ROWS; row++) {
+            const auto factor = lhs(row, k) / lhs(k, k);
+            native_for<ROWS>([&lhs, factor, row, k](size_t col) { lhs(row, col) -= factor * lhs(k, col); });
+            native_for<COLS>([&rhs, factor, row, k](size_t col) { rhs(row, col) -= factor * rhs(k, col); });
+        }
+    }
+
+    // Back substitution, the solution replaces the right hand side
+    for (size_t k = ROWS; k-- > 0;) {
+        native_for<COLS>([&lhs, &rhs, k](size_t col) {
+            scalar_type sum = rhs(k, col);
+            for (size_t i = k + 1; i < ROWS; i++)
+                sum -= lhs(k, i) * rhs(i, col);
+            rhs(k, col) = sum / lhs(k, k);
+        });
+    }
+    return rhs;
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS = ROWS>
+using matrix_native_t = native_matrix<scalar_type, ROWS, COLS>;
+
+}
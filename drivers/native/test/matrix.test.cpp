@@ -0,0 +1,94 @@
+#include <emblib/math/matrix.hpp>
+#include <emblib/math/vector.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+
+using emblib::math::matrixf;
+using emblib::math::vectorf;
+
+namespace {
+
+template <size_t ROWS, size_t COLS>
+bool is_approx(const matrixf<ROWS, COLS>& lhs, const matrixf<ROWS, COLS>& rhs)
+{
+    for (size_t row = 0; row < ROWS; row++) {
+        for (size_t col = 0; col < COLS; col++) {
+            if (std::abs(lhs(row, col) - rhs(row, col)) > 1e-4f)
+                return false;
+        }
+    }
+    return true;
+}
+
+constexpr matrixf<2, 2> A {{1, 2}, {3, 4}};
+constexpr matrixf<2, 2> B {{5, 6}, {7, 8}};
+
+// Operations are evaluated at compile time
+static_assert((A + B == matrixf<2, 2>({{6, 8}, {10, 12}})).all());
+static_assert((A.matmul(B) == matrixf<2, 2>({{19, 22}, {43, 50}})).all());
+static_assert((A.transpose() == matrixf<2, 2>({{1, 3}, {2, 4}})).all());
+static_assert((B.matdivl(A) == matrixf<2, 2>({{-3, -4}, {4, 5}})).all());
+static_assert(vectorf<3>{1, 2, 3}.dot(vectorf<3>{4, 5, 6}) == 32);
+static_assert(matrixf<3>::diagonal(2)(1, 1) == 2 && matrixf<3>::diagonal(2)(1, 0) == 0);
+
+}
+
+TEST_CASE("Native matrix division", "[native][matrix]")
+{
+    // Result of inv(a) * b
+    matrixf<2, 2> left_div_exp {{-3, -4}, {4, 5}};
+    // Result of b * inv(a)
+    matrixf<2, 2> right_div_exp {{-1, 2}, {-2, 3}};
+
+    REQUIRE(is_approx(B.matdivl(A), left_div_exp));
+    REQUIRE(is_approx(B.matdivr(A), right_div_exp));
+
+    // Zero on the diagonal needs pivoting
+    matrixf<3> c {{0, 1, 2}, {1, 0, 3}, {4, -3, 8}};
+    matrixf<3> identity = matrixf<3>::diagonal();
+    REQUIRE(is_approx(c.matmul(identity.matdivl(c)), identity));
+}
+
+TEST_CASE("Native matrix large matmul", "[native][matrix]")
+{
+    // Too large to be unrolled
+    matrixf<12> a(1);
+    matrixf<12> b = matrixf<12>::diagonal(2);
+    REQUIRE((a.matmul(b) == matrixf<12>(2)).all());
+}
+
+TEST_CASE("Native matrix logical", "[native][matrix]")
+{
+    matrixf<2, 2> a = {{1, 2}, {7, 8}};
+    matrixf<2, 2> b = {{3, 4}, {5, 6}};
+    matrixf<2, 2> c = {{5, 10}, {15, 20}};
+
+    REQUIRE(((a < b).cast<float>() * c == matrixf<2, 2>({{5, 10}, {0, 0}})).all());
+    REQUIRE((!(a == b)).all());
+    REQUIRE_FALSE((a == b).any());
+}
+
+TEST_CASE("Native matrix column initialization", "[native][matrix]")
+{
+    matrixf<2, 1> a {{1, 2}};
+    matrixf<2, 1> b {{1}, {2}};
+    REQUIRE((a == b).all());
+}
+
+TEST_CASE("Native matrix submatrix edit", "[native][matrix]")
+{
+    matrixf<3, 4> a {{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}};
+
+    auto submatrix = a.get_submatrix<1, 2, 2, 2>();
+    submatrix(0, 0) = 20;
+    submatrix(1, 1) = 30;
+    submatrix += matrixf<2, 2>(1);
+
+    matrixf<3, 4> expected {{1, 2, 3, 4}, {5, 6, 21, 9}, {9, 10, 12, 31}};
+    REQUIRE((a == expected).all());
+
+    // Blocks can be copied into matrices
+    matrixf<2, 2> copy = a.get_submatrix<0, 0, 2, 2>();
+    REQUIRE((copy == matrixf<2, 2>({{1, 2}, {5, 6}})).all());
+}
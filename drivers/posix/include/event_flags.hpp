@@ -0,0 +1,37 @@
+#pragma once
+
+#include <emblib/lockfree/cache_line.hpp>
+#include <emblib/rtos/event_flags.hpp>
+#include <atomic>
+#include <cstdint>
+
+namespace emblib::posix {
+
+/**
+ * Implementation of the event flags interface using a Linux futex.
+ *
+ * Setting flags only makes the wake up system call while a thread is
+ * waiting, and all the waiters are woken up to check their condition.
+ */
+class event_flags : public rtos::event_flags {
+public:
+    explicit event_flags(uint32_t initial_flags = 0) noexcept;
+
+    // Non-copyable, non-movable
+    event_flags(const event_flags&) = delete;
+    event_flags& operator=(const event_flags&) = delete;
+    event_flags(event_flags&&) = delete;
+    event_flags& operator=(event_flags&&) = delete;
+
+    void set(uint32_t flags) noexcept override;
+    void clear(uint32_t flags) noexcept override;
+    uint32_t get() const noexcept override;
+    uint32_t wait(uint32_t mask, wait_e condition, io::timeout timeout) noexcept override;
+
+private:
+    // Futex word
+    alignas(lockfree::CACHE_LINE_SIZE) std::atomic<uint32_t> m_flags;
+    std::atomic<uint32_t> m_waiter_count;
+};
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <emblib/lockfree/cache_line.hpp>
+#include <emblib/lockfree/wait_strategy.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::posix {
+
+/**
+ * Wait strategy which spins for a while and then parks the thread on a
+ * Linux futex until the producer publishes an item.
+ *
+ * Waiters announce themselves before parking, so the producer only makes
+ * the wake up system call while someone is parked. Without waiters, `notify`
+ * costs a fence and a load of a counter which stays in the shared state, no
+ * atomic read-modify-write or system call.
+ */
+class futex_wait {
+public:
+    /**
+     * @param spin_count Number of tries before parking the thread
+     */
+    explicit futex_wait(size_t spin_count = 100) noexcept;
+
+    // Non-copyable, non-movable
+    futex_wait(const futex_wait&) = delete;
+    futex_wait& operator=(const futex_wait&) = delete;
+    futex_wait(futex_wait&&) = delete;
+    futex_wait& operator=(futex_wait&&) = delete;
+
+    /**
+     * Call `try_fn` until it succeeds or the timeout expires.
+     */
+    bool wait(lockfree::try_fn_t try_fn, io::timeout timeout) noexcept;
+
+    /**
+     * Wake up all the parked waiters, if there are any.
+     */
+    void notify() noexcept;
+
+private:
+    size_t m_spin_count;
+
+    // Futex word, incremented on every wake up
+    alignas(lockfree::CACHE_LINE_SIZE) std::atomic<uint32_t> m_sequence;
+    std::atomic<uint32_t> m_waiter_count;
+};
+
+}
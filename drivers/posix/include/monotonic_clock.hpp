@@ -0,0 +1,20 @@
+#pragma once
+
+#include <emblib/rtos/clock.hpp>
+
+namespace emblib::posix {
+
+/**
+ * Implementation of the clock interface using `CLOCK_MONOTONIC`.
+ *
+ * Sleeps with `clock_nanosleep` and `TIMER_ABSTIME`, so the wake up time
+ * doesn't depend on when the thread computed it, and sleeps interrupted
+ * by signals are resumed until the time is reached.
+ */
+class monotonic_clock : public rtos::clock {
+public:
+    std::chrono::nanoseconds now() const noexcept override;
+    void sleep_until(std::chrono::nanoseconds time) noexcept override;
+};
+
+}
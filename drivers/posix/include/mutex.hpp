@@ -0,0 +1,42 @@
+#pragma once
+
+#include <emblib/rtos/mutex.hpp>
+#include <atomic>
+#include <cstdint>
+
+namespace emblib::posix {
+
+/**
+ * Implementation of the mutex interface using a Linux futex.
+ *
+ * The lock word records whether there may be sleeping waiters, so locking
+ * and unlocking without contention are a single atomic operation and the
+ * wake up system call is only made when someone is sleeping.
+ */
+class mutex : public rtos::mutex {
+    enum state_e : uint32_t {
+        UNLOCKED,
+        LOCKED,
+        // Locked, and there may be threads sleeping on the word
+        CONTENDED
+    };
+
+public:
+    mutex() noexcept;
+
+    // Non-copyable, non-movable
+    mutex(const mutex&) = delete;
+    mutex& operator=(const mutex&) = delete;
+    mutex(mutex&&) = delete;
+    mutex& operator=(mutex&&) = delete;
+
+    void lock() noexcept override;
+    bool try_lock() noexcept override;
+    void unlock() noexcept override;
+
+private:
+    // Futex word, one of the `state_e` values
+    std::atomic<uint32_t> m_state;
+};
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <emblib/rtos/pi_mutex.hpp>
+#include <pthread.h>
+
+namespace emblib::posix {
+
+/**
+ * Implementation of the priority inheritance mutex interface using
+ * a POSIX mutex with the `PTHREAD_PRIO_INHERIT` protocol.
+ *
+ * On Linux the mutex is backed by a PI futex, so the kernel boosts
+ * the owner while real-time threads wait for it.
+ */
+class pi_mutex : public rtos::pi_mutex {
+public:
+    pi_mutex() noexcept;
+    ~pi_mutex() noexcept override;
+
+    // Non-copyable, non-movable
+    pi_mutex(const pi_mutex&) = delete;
+    pi_mutex& operator=(const pi_mutex&) = delete;
+    pi_mutex(pi_mutex&&) = delete;
+    pi_mutex& operator=(pi_mutex&&) = delete;
+
+    /**
+     * Check if the mutex was created with priority inheritance,
+     * otherwise it works as a plain mutex.
+     */
+    bool is_valid() const noexcept;
+
+    void lock() noexcept override;
+    bool try_lock() noexcept override;
+    void unlock() noexcept override;
+
+    /** Returns the underlying mutex. */
+    pthread_mutex_t* native_handle() noexcept { return &m_mutex; }
+
+private:
+    pthread_mutex_t m_mutex;
+    bool m_is_valid = false;
+};
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <emblib/lockfree/cache_line.hpp>
+#include <emblib/rtos/semaphore.hpp>
+#include <atomic>
+#include <cstdint>
+
+namespace emblib::posix {
+
+/**
+ * Implementation of the counting semaphore interface using a Linux futex.
+ *
+ * Taking an available unit and giving without waiters only costs atomic
+ * operations, the system calls are made only when a thread has to sleep.
+ */
+class semaphore : public rtos::semaphore {
+public:
+    explicit semaphore(uint32_t initial_count = 0) noexcept;
+
+    // Non-copyable, non-movable
+    semaphore(const semaphore&) = delete;
+    semaphore& operator=(const semaphore&) = delete;
+    semaphore(semaphore&&) = delete;
+    semaphore& operator=(semaphore&&) = delete;
+
+    bool take(io::timeout timeout) noexcept override;
+    void give() noexcept override;
+    size_t get_count() const noexcept override;
+
+private:
+    // Futex word
+    alignas(lockfree::CACHE_LINE_SIZE) std::atomic<uint32_t> m_count;
+    std::atomic<uint32_t> m_waiter_count;
+};
+
+}
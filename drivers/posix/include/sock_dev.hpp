@@ -1,10 +1,11 @@
 #pragma once
 
 #include <emblib/io/iodev.hpp>
+#include <emblib/metrics/counters.hpp>
+#include <emblib/posix/event_flags.hpp>
+#include <emblib/posix/mutex.hpp>
+#include <emblib/posix/thread.hpp>
 #include <atomic>
-#include <condition_variable>
-#include <mutex>
-#include <thread>
 
 namespace emblib::posix {
 
@@ -15,14 +16,30 @@ namespace emblib::posix {
  * file descriptor and it is up to the user to close it.
  *
  * Provides synchronous read/write with timeout, and asynchronous read
- * backed by a persistent background thread that can be aborted.
+ * backed by a persistent background thread that can be aborted. The
+ * thread can be configured, for example to run latency critical IO
+ * under a real-time priority pinned to a CPU.
  */
 class sock_dev : public io::iodev {
 public:
-    explicit sock_dev(int fd) noexcept;
+    /**
+     * Indices of the device metrics, collected if metrics are enabled.
+     */
+    enum metric_e : size_t {
+        RX_BYTES,
+        TX_BYTES,
+        TIMEOUTS,
+        ERRORS,
+        METRIC_COUNT
+    };
+
+    static constexpr const char* METRIC_NAMES[METRIC_COUNT] = {"rx_bytes", "tx_bytes", "timeouts", "errors"};
+
+public:
+    explicit sock_dev(int fd, const rtos::thread_config_s& async_thread_config = {}) noexcept;
     ~sock_dev() noexcept;
 
-    // Non-copyable, non-movable (has std::thread member)
+    // Non-copyable, non-movable (has thread member)
     sock_dev(const sock_dev&) = delete;
     sock_dev& operator=(const sock_dev&) = delete;
     sock_dev(sock_dev&&) = delete;
@@ -36,7 +53,8 @@ public:
     /**
      * Non-blocking receive with an infinite timeout.
      * Submits a job to the background thread. Returns error::BUSY if
-     * an async read is already in progress.
+     * an async read is already in progress, or error::IO if the thread
+     * couldn't be started with the requested configuration.
      */
     etl::expected<void, io::error> read_async(etl::span<uint8_t> buffer, io::async_cb cb) noexcept override;
 
@@ -54,25 +72,44 @@ public:
     /** Returns the underlying file descriptor. */
     int fd() const noexcept { return m_fd; }
 
+    /** Returns the metrics, indexed by `metric_e`. */
+    const metrics::counters<METRIC_COUNT>& get_metrics() const noexcept { return m_metrics; }
+
 private:
+    /**
+     * Events of the async read thread.
+     */
+    enum async_event_e : uint32_t {
+        ASYNC_JOB = 1 << 0,
+        ASYNC_SHUTDOWN = 1 << 1
+    };
+
     /**
      * Async read thread which waits in a loop for read operations.
      */
     void async_thread_fn() noexcept;
 
+    /**
+     * Count the result of an operation in the metrics.
+     */
+    io::result count_result(io::result result, metric_e bytes_metric) noexcept;
+
 private:
     int m_fd;
     int m_pipe_fds[2]; // [0]=read-end, [1]=write-end
 
-    bool m_shutdown = false;
     std::atomic<bool> m_active{false};
     std::atomic<bool> m_abort{false};
     etl::span<uint8_t> m_async_buf;
     io::async_cb m_async_cb;
 
-    std::mutex m_async_mtx;
-    std::condition_variable m_async_cv;
-    std::thread m_async_thread; // must be last member
+    posix::mutex m_async_mtx;
+    posix::event_flags m_async_events;
+
+    // Empty if metrics are disabled
+    EMBLIB_NO_UNIQUE_ADDRESS metrics::counters<METRIC_COUNT> m_metrics;
+
+    posix::thread m_async_thread; // must be last member
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <emblib/rtos/thread.hpp>
+#include <pthread.h>
+
+namespace emblib::posix {
+
+/**
+ * Implementation of the thread interface using POSIX threads.
+ *
+ * Threads with a priority above 0 run under the SCHED_FIFO policy, which
+ * usually requires the CAP_SYS_NICE capability or an RLIMIT_RTPRIO limit.
+ * If any part of the configuration can't be applied, the thread isn't
+ * started and `is_valid` returns `false`.
+ */
+class thread : public rtos::thread {
+public:
+    /**
+     * Start a thread executing `fn`.
+     */
+    explicit thread(rtos::thread_fn_t fn, const rtos::thread_config_s& config = {}) noexcept;
+
+    /**
+     * Joins the thread.
+     */
+    ~thread() noexcept override;
+
+    // Non-copyable, non-movable (the thread references this object)
+    thread(const thread&) = delete;
+    thread& operator=(const thread&) = delete;
+    thread(thread&&) = delete;
+    thread& operator=(thread&&) = delete;
+
+    bool is_valid() const noexcept override;
+    void join() noexcept override;
+    bool set_priority(int priority) noexcept override;
+    bool set_affinity(uint32_t affinity) noexcept override;
+
+    /** Returns the underlying thread handle. */
+    pthread_t native_handle() const noexcept { return m_handle; }
+
+private:
+    static void* entry(void* arg) noexcept;
+
+private:
+    rtos::thread_fn_t m_fn;
+    pthread_t m_handle{};
+    bool m_is_valid = false;
+    bool m_is_joined = false;
+};
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <emblib/io/types.hpp>
+#include <chrono>
+
+namespace emblib::posix {
+
+/**
+ * Periodic tick source backed by a Linux `timerfd`.
+ *
+ * A single file descriptor counts the elapsed ticks, so it can drive
+ * any number of software timers (for example `rtos::timer_wheel`) with
+ * one kernel wait per wakeup, and can be polled together with other
+ * file descriptors.
+ *
+ * @note Uses the monotonic clock, so the ticks are not affected by
+ * changes of the system time.
+ */
+class timer_fd {
+public:
+    /**
+     * Create the timer and start ticking with the given period.
+     * @note Period must be positive
+     */
+    explicit timer_fd(std::chrono::nanoseconds tick) noexcept;
+    ~timer_fd() noexcept;
+
+    // Non-copyable, non-movable
+    timer_fd(const timer_fd&) = delete;
+    timer_fd& operator=(const timer_fd&) = delete;
+    timer_fd(timer_fd&&) = delete;
+    timer_fd& operator=(timer_fd&&) = delete;
+
+    /**
+     * Check if the timer was created and started.
+     */
+    bool is_valid() const noexcept;
+
+    /**
+     * Wait for at least one tick.
+     *
+     * @returns Number of ticks elapsed since the last call, including the
+     * ones which were missed because the caller was late, or
+     * `error::TIMEOUT` if no tick elapsed before the timeout, or
+     * `error::INVAL` if the timer isn't valid.
+     */
+    io::result wait(io::timeout timeout) noexcept;
+
+    /** Returns the underlying file descriptor. */
+    int fd() const noexcept { return m_fd; }
+
+private:
+    int m_fd;
+};
+
+}
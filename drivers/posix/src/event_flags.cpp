@@ -0,0 +1,64 @@
+#include <emblib/posix/event_flags.hpp>
+#include <emblib/lockfree/wait_strategy.hpp>
+#include "futex.hpp"
+
+#include <climits>
+
+namespace emblib::posix {
+
+event_flags::event_flags(uint32_t initial_flags) noexcept :
+    m_flags(initial_flags),
+    m_waiter_count(0)
+{}
+
+void
+event_flags::set(uint32_t flags) noexcept
+{
+    m_flags.fetch_or(flags, std::memory_order_seq_cst);
+    // Waiters may wait for different flags, so all of them check their condition
+    if (m_waiter_count.load(std::memory_order_seq_cst) != 0)
+        details::futex_wake(m_flags, INT_MAX);
+}
+
+void
+event_flags::clear(uint32_t flags) noexcept
+{
+    m_flags.fetch_and(~flags, std::memory_order_release);
+}
+
+uint32_t
+event_flags::get() const noexcept
+{
+    return m_flags.load(std::memory_order_acquire);
+}
+
+uint32_t
+event_flags::wait(uint32_t mask, wait_e condition, io::timeout timeout) noexcept
+{
+    if (mask == 0)
+        return 0;
+
+    const lockfree::details::deadline deadline(timeout);
+
+    while (true) {
+        uint32_t flags = m_flags.load(std::memory_order_acquire);
+        uint32_t matched = flags & mask;
+
+        while (condition == wait_e::ANY ? matched != 0 : matched == mask) {
+            if (m_flags.compare_exchange_weak(flags, flags & ~matched, std::memory_order_acq_rel, std::memory_order_acquire))
+                return matched;
+            matched = flags & mask;
+        }
+
+        const auto remaining = deadline.get_remaining();
+        if (remaining == std::chrono::nanoseconds::zero())
+            return 0;
+
+        // Sleeps only if no flag changed since the check
+        m_waiter_count.fetch_add(1, std::memory_order_seq_cst);
+        details::futex_park(m_flags, flags, remaining);
+        m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+}
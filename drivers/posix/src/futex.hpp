@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace emblib::posix::details {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+
+/**
+ * Sleep while the word holds the expected value, until woken up or the timeout expires.
+ * `std::chrono::nanoseconds::max()` waits without a timeout.
+ */
+inline void
+futex_park(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::nanoseconds timeout) noexcept
+{
+    ::timespec ts{};
+    ::timespec* ts_ptr = nullptr;
+
+    if (timeout != std::chrono::nanoseconds::max()) {
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+        ts.tv_sec = seconds.count();
+        ts.tv_nsec = (timeout - seconds).count();
+        ts_ptr = &ts;
+    }
+
+    // Returns immediately if the word no longer holds the expected value
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, ts_ptr, nullptr, 0);
+}
+
+/**
+ * Wake up to `count` threads sleeping on the word.
+ */
+inline void
+futex_wake(std::atomic<uint32_t>& word, int count) noexcept
+{
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+}
@@ -0,0 +1,59 @@
+#include <emblib/posix/futex_wait.hpp>
+#include "futex.hpp"
+
+#include <climits>
+
+namespace emblib::posix {
+
+futex_wait::futex_wait(size_t spin_count) noexcept :
+    m_spin_count(spin_count),
+    m_sequence(0),
+    m_waiter_count(0)
+{}
+
+bool
+futex_wait::wait(lockfree::try_fn_t try_fn, io::timeout timeout) noexcept
+{
+    const lockfree::details::deadline deadline(timeout);
+
+    for (size_t i = 0; i < m_spin_count; i++) {
+        if (try_fn())
+            return true;
+        if (deadline.has_expired())
+            return false;
+        lockfree::cpu_relax();
+    }
+
+    while (true) {
+        // Announce the waiter before the last try, so that an item pushed
+        // after the try either sees the waiter or changes the sequence
+        m_waiter_count.fetch_add(1, std::memory_order_seq_cst);
+        const uint32_t sequence = m_sequence.load(std::memory_order_seq_cst);
+
+        const bool success = try_fn();
+        const auto remaining = deadline.get_remaining();
+        if (!success && remaining != std::chrono::nanoseconds::zero())
+            details::futex_park(m_sequence, sequence, remaining);
+
+        m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+
+        if (success)
+            return true;
+        if (remaining == std::chrono::nanoseconds::zero())
+            return try_fn();
+    }
+}
+
+void
+futex_wait::notify() noexcept
+{
+    // Orders the publish of the item before the check for waiters
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waiter_count.load(std::memory_order_relaxed) == 0)
+        return;
+
+    m_sequence.fetch_add(1, std::memory_order_release);
+    details::futex_wake(m_sequence, INT_MAX);
+}
+
+}
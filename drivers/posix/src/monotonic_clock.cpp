@@ -0,0 +1,29 @@
+#include <emblib/posix/monotonic_clock.hpp>
+
+#include <cerrno>
+#include <ctime>
+
+namespace emblib::posix {
+
+std::chrono::nanoseconds
+monotonic_clock::now() const noexcept
+{
+    ::timespec ts{};
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+void
+monotonic_clock::sleep_until(std::chrono::nanoseconds time) noexcept
+{
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(time);
+
+    ::timespec ts{};
+    ts.tv_sec = seconds.count();
+    ts.tv_nsec = (time - seconds).count();
+
+    // Absolute time stays the same when restarted after a signal
+    while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {}
+}
+
+}
@@ -0,0 +1,43 @@
+#include <emblib/posix/mutex.hpp>
+#include "futex.hpp"
+
+namespace emblib::posix {
+
+mutex::mutex() noexcept :
+    m_state(UNLOCKED)
+{}
+
+void
+mutex::lock() noexcept
+{
+    uint32_t state = UNLOCKED;
+    if (m_state.compare_exchange_strong(state, LOCKED, std::memory_order_acquire, std::memory_order_relaxed))
+        return;
+
+    // Mark the mutex as contended before sleeping, so the owner wakes this thread up.
+    // A thread taking the mutex this way can't know if others still sleep, so it keeps
+    // the mark and unlocking wakes one of them, if any.
+    if (state != CONTENDED)
+        state = m_state.exchange(CONTENDED, std::memory_order_acquire);
+
+    while (state != UNLOCKED) {
+        details::futex_park(m_state, CONTENDED, std::chrono::nanoseconds::max());
+        state = m_state.exchange(CONTENDED, std::memory_order_acquire);
+    }
+}
+
+bool
+mutex::try_lock() noexcept
+{
+    uint32_t state = UNLOCKED;
+    return m_state.compare_exchange_strong(state, LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void
+mutex::unlock() noexcept
+{
+    if (m_state.exchange(UNLOCKED, std::memory_order_release) == CONTENDED)
+        details::futex_wake(m_state, 1);
+}
+
+}
@@ -0,0 +1,50 @@
+#include <emblib/posix/pi_mutex.hpp>
+
+namespace emblib::posix {
+
+pi_mutex::pi_mutex() noexcept
+{
+    pthread_mutexattr_t attr;
+    if (::pthread_mutexattr_init(&attr) == 0) {
+        m_is_valid = ::pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT) == 0 &&
+                     ::pthread_mutex_init(&m_mutex, &attr) == 0;
+        ::pthread_mutexattr_destroy(&attr);
+    }
+
+    if (!m_is_valid) {
+        // Fall back to a mutex without priority inheritance, so locking is still safe
+        const pthread_mutex_t fallback = PTHREAD_MUTEX_INITIALIZER;
+        m_mutex = fallback;
+    }
+}
+
+pi_mutex::~pi_mutex() noexcept
+{
+    ::pthread_mutex_destroy(&m_mutex);
+}
+
+bool
+pi_mutex::is_valid() const noexcept
+{
+    return m_is_valid;
+}
+
+void
+pi_mutex::lock() noexcept
+{
+    ::pthread_mutex_lock(&m_mutex);
+}
+
+bool
+pi_mutex::try_lock() noexcept
+{
+    return ::pthread_mutex_trylock(&m_mutex) == 0;
+}
+
+void
+pi_mutex::unlock() noexcept
+{
+    ::pthread_mutex_unlock(&m_mutex);
+}
+
+}
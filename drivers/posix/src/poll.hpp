@@ -0,0 +1,21 @@
+#pragma once
+
+#include <emblib/io/types.hpp>
+
+namespace emblib::posix::details {
+
+/**
+ * Convert the timeout to the milliseconds argument of `poll`,
+ * where 0 returns immediately and -1 waits without a timeout.
+ */
+inline int
+to_poll_ms(io::timeout t) noexcept
+{
+    if (t == io::timeout::min())
+        return 0;
+    if (t == io::timeout::max())
+        return -1;
+    return static_cast<int>(t.count());
+}
+
+}
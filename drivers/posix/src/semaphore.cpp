@@ -0,0 +1,50 @@
+#include <emblib/posix/semaphore.hpp>
+#include <emblib/lockfree/wait_strategy.hpp>
+#include "futex.hpp"
+
+namespace emblib::posix {
+
+semaphore::semaphore(uint32_t initial_count) noexcept :
+    m_count(initial_count),
+    m_waiter_count(0)
+{}
+
+bool
+semaphore::take(io::timeout timeout) noexcept
+{
+    const lockfree::details::deadline deadline(timeout);
+
+    while (true) {
+        uint32_t count = m_count.load(std::memory_order_relaxed);
+        while (count > 0) {
+            if (m_count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+
+        const auto remaining = deadline.get_remaining();
+        if (remaining == std::chrono::nanoseconds::zero())
+            return false;
+
+        // Announced before sleeping, so a unit given in the meantime
+        // either sees the waiter or changes the count and prevents the sleep
+        m_waiter_count.fetch_add(1, std::memory_order_seq_cst);
+        details::futex_park(m_count, 0, remaining);
+        m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void
+semaphore::give() noexcept
+{
+    m_count.fetch_add(1, std::memory_order_seq_cst);
+    if (m_waiter_count.load(std::memory_order_seq_cst) != 0)
+        details::futex_wake(m_count, 1);
+}
+
+size_t
+semaphore::get_count() const noexcept
+{
+    return m_count.load(std::memory_order_relaxed);
+}
+
+}
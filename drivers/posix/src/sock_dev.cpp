@@ -1,4 +1,6 @@
 #include <emblib/posix/sock_dev.hpp>
+#include <emblib/rtos/lock.hpp>
+#include "poll.hpp"
 
 #include <fcntl.h>
 #include <poll.h>
@@ -7,18 +9,10 @@
 
 namespace emblib::posix {
 
-static int
-to_poll_ms(io::timeout t) noexcept
-{
-    if (t == io::timeout::min())
-        return 0;
-    if (t == io::timeout::max())
-        return -1;
-    return static_cast<int>(t.count());
-}
-
-sock_dev::sock_dev(int fd) noexcept :
-    m_fd(fd)
+sock_dev::sock_dev(int fd, const rtos::thread_config_s& async_thread_config) noexcept :
+    m_fd(fd),
+    // The thread only uses the pipe once a job is submitted, after construction
+    m_async_thread(rtos::thread_fn_t::create<sock_dev, &sock_dev::async_thread_fn>(*this), async_thread_config)
 {
     // Create abort pipe for signaling the async thread
     ::pipe(m_pipe_fds);
@@ -26,17 +20,11 @@ sock_dev::sock_dev(int fd) noexcept :
     // Set both pipe ends non-blocking to avoid blocking on read/write
     ::fcntl(m_pipe_fds[0], F_SETFL, ::fcntl(m_pipe_fds[0], F_GETFL) | O_NONBLOCK);
     ::fcntl(m_pipe_fds[1], F_SETFL, ::fcntl(m_pipe_fds[1], F_GETFL) | O_NONBLOCK);
-
-    m_async_thread = std::thread([this] { async_thread_fn(); });
 }
 
 sock_dev::~sock_dev() noexcept
 {
-    {
-        std::lock_guard lock(m_async_mtx);
-        m_shutdown = true;
-    }
-    m_async_cv.notify_one();
+    m_async_events.set(ASYNC_SHUTDOWN);
     m_async_thread.join();
 
     ::close(m_pipe_fds[0]);
@@ -51,18 +39,18 @@ sock_dev::read(etl::span<uint8_t> buffer, io::timeout timeout) noexcept
     }
 
     ::pollfd pfd{m_fd, POLLIN, 0};
-    int ret = ::poll(&pfd, 1, to_poll_ms(timeout));
+    int ret = ::poll(&pfd, 1, details::to_poll_ms(timeout));
 
     if (ret == 0)
-        return etl::unexpected{io::error::TIMEOUT};
+        return count_result(etl::unexpected{io::error::TIMEOUT}, RX_BYTES);
     if (ret < 0)
-        return etl::unexpected{io::error::IO};
+        return count_result(etl::unexpected{io::error::IO}, RX_BYTES);
 
     ssize_t n = ::recv(m_fd, buffer.data(), buffer.size(), 0);
     if (n <= 0)
-        return etl::unexpected{io::error::IO};
+        return count_result(etl::unexpected{io::error::IO}, RX_BYTES);
 
-    return static_cast<size_t>(n);
+    return count_result(static_cast<size_t>(n), RX_BYTES);
 }
 
 io::result
@@ -73,18 +61,18 @@ sock_dev::write(etl::span<const uint8_t> data, io::timeout timeout) noexcept
     }
 
     ::pollfd pfd{m_fd, POLLOUT, 0};
-    int ret = ::poll(&pfd, 1, to_poll_ms(timeout));
+    int ret = ::poll(&pfd, 1, details::to_poll_ms(timeout));
 
     if (ret == 0)
-        return etl::unexpected{io::error::TIMEOUT};
+        return count_result(etl::unexpected{io::error::TIMEOUT}, TX_BYTES);
     if (ret < 0)
-        return etl::unexpected{io::error::IO};
+        return count_result(etl::unexpected{io::error::IO}, TX_BYTES);
 
     ssize_t n = ::send(m_fd, data.data(), data.size(), MSG_NOSIGNAL);
     if (n <= 0)
-        return etl::unexpected{io::error::IO};
+        return count_result(etl::unexpected{io::error::IO}, TX_BYTES);
 
-    return static_cast<size_t>(n);
+    return count_result(static_cast<size_t>(n), TX_BYTES);
 }
 
 etl::expected<void, io::error>
@@ -94,18 +82,24 @@ sock_dev::read_async(etl::span<uint8_t> buffer, io::async_cb cb) noexcept
         return etl::unexpected{io::error::INVAL};
     }
 
-    std::lock_guard lock(m_async_mtx);
-
-    // Only allow one active async read at a time
-    if (m_active.load(std::memory_order_relaxed)) {
-        return etl::unexpected{io::error::BUSY};
+    if (!m_async_thread.is_valid()) {
+        return etl::unexpected{io::error::IO};
     }
 
-    m_async_buf = buffer;
-    m_async_cb = cb;
+    {
+        rtos::scoped_lock lock(m_async_mtx);
+
+        // Only allow one active async read at a time
+        if (m_active.load(std::memory_order_relaxed)) {
+            return etl::unexpected{io::error::BUSY};
+        }
 
-    m_active.store(true, std::memory_order_relaxed);
-    m_async_cv.notify_one();
+        m_async_buf = buffer;
+        m_async_cb = cb;
+
+        m_active.store(true, std::memory_order_relaxed);
+    }
+    m_async_events.set(ASYNC_JOB);
 
     return {};
 }
@@ -126,15 +120,11 @@ bool sock_dev::abort_async_read() noexcept
 void sock_dev::async_thread_fn() noexcept
 {
     while (true) {
-        {
-            std::unique_lock lock(m_async_mtx);
-            m_async_cv.wait(lock, [this] {
-                return m_shutdown ||
-                       m_active.load(std::memory_order_relaxed);
-            });
-        }
+        const uint32_t events = m_async_events.wait(ASYNC_JOB | ASYNC_SHUTDOWN,
+                                                    rtos::event_flags::wait_e::ANY,
+                                                    io::timeout::max());
 
-        if (m_shutdown) {
+        if (events & ASYNC_SHUTDOWN) {
             return;
         }
 
@@ -160,12 +150,25 @@ void sock_dev::async_thread_fn() noexcept
 
         io::async_cb cb;
         {
-            std::lock_guard lock(m_async_mtx);
+            rtos::scoped_lock lock(m_async_mtx);
             cb = m_async_cb;
             m_active.store(false, std::memory_order_release);
         }
-        cb(result);
+        cb(count_result(result, RX_BYTES));
     }
 }
 
+io::result
+sock_dev::count_result(io::result result, metric_e bytes_metric) noexcept
+{
+    if (result)
+        m_metrics.add(bytes_metric, static_cast<int64_t>(*result));
+    else if (result.error() == io::error::TIMEOUT)
+        m_metrics.add(TIMEOUTS);
+    else if (result.error() != io::error::ABORT)
+        m_metrics.add(ERRORS);
+
+    return result;
+}
+
 }
@@ -0,0 +1,120 @@
+#include <emblib/posix/thread.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <sched.h>
+
+namespace emblib::posix {
+
+static void
+to_cpu_set(uint32_t affinity, cpu_set_t& cpus) noexcept
+{
+    CPU_ZERO(&cpus);
+    for (int cpu = 0; cpu < 32; cpu++) {
+        // No affinity allows all the CPUs
+        if (affinity == 0 || (affinity & (uint32_t(1) << cpu)))
+            CPU_SET(cpu, &cpus);
+    }
+}
+
+static int
+to_sched_param(int priority, sched_param& param) noexcept
+{
+    if (priority <= 0) {
+        param.sched_priority = 0;
+        return SCHED_OTHER;
+    }
+
+    param.sched_priority = std::clamp(priority, ::sched_get_priority_min(SCHED_FIFO), ::sched_get_priority_max(SCHED_FIFO));
+    return SCHED_FIFO;
+}
+
+thread::thread(rtos::thread_fn_t fn, const rtos::thread_config_s& config) noexcept :
+    m_fn(fn)
+{
+    pthread_attr_t attr;
+    if (::pthread_attr_init(&attr) != 0)
+        return;
+
+    bool is_configured = true;
+
+    if (!config.stack.empty())
+        is_configured &= ::pthread_attr_setstack(&attr, config.stack.data(), config.stack.size()) == 0;
+
+    if (config.priority > 0) {
+        sched_param param;
+        const int policy = to_sched_param(config.priority, param);
+        is_configured &= ::pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED) == 0;
+        is_configured &= ::pthread_attr_setschedpolicy(&attr, policy) == 0;
+        is_configured &= ::pthread_attr_setschedparam(&attr, &param) == 0;
+    }
+
+    if (config.affinity != 0) {
+        cpu_set_t cpus;
+        to_cpu_set(config.affinity, cpus);
+        is_configured &= ::pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus) == 0;
+    }
+
+    if (is_configured)
+        m_is_valid = ::pthread_create(&m_handle, &attr, entry, this) == 0;
+    ::pthread_attr_destroy(&attr);
+
+    if (m_is_valid && config.name != nullptr) {
+        // Linux limits the name to 15 characters
+        char name[16] = {};
+        std::strncpy(name, config.name, sizeof(name) - 1);
+        ::pthread_setname_np(m_handle, name);
+    }
+}
+
+thread::~thread() noexcept
+{
+    join();
+}
+
+bool
+thread::is_valid() const noexcept
+{
+    return m_is_valid;
+}
+
+void
+thread::join() noexcept
+{
+    if (!m_is_valid || m_is_joined)
+        return;
+
+    ::pthread_join(m_handle, nullptr);
+    m_is_joined = true;
+}
+
+bool
+thread::set_priority(int priority) noexcept
+{
+    if (!m_is_valid || m_is_joined)
+        return false;
+
+    sched_param param;
+    const int policy = to_sched_param(priority, param);
+    return ::pthread_setschedparam(m_handle, policy, &param) == 0;
+}
+
+bool
+thread::set_affinity(uint32_t affinity) noexcept
+{
+    if (!m_is_valid || m_is_joined)
+        return false;
+
+    cpu_set_t cpus;
+    to_cpu_set(affinity, cpus);
+    return ::pthread_setaffinity_np(m_handle, sizeof(cpus), &cpus) == 0;
+}
+
+void*
+thread::entry(void* arg) noexcept
+{
+    static_cast<thread*>(arg)->m_fn();
+    return nullptr;
+}
+
+}
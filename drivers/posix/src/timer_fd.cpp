@@ -0,0 +1,69 @@
+#include <emblib/posix/timer_fd.hpp>
+#include "poll.hpp"
+
+#include <cstdint>
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace emblib::posix {
+
+timer_fd::timer_fd(std::chrono::nanoseconds tick) noexcept :
+    m_fd(-1)
+{
+    // Zero period would disarm the timer, so waits would never end
+    if (tick <= std::chrono::nanoseconds::zero())
+        return;
+
+    const int fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0)
+        return;
+
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(tick);
+    ::itimerspec spec{};
+    spec.it_interval.tv_sec = seconds.count();
+    spec.it_interval.tv_nsec = (tick - seconds).count();
+    spec.it_value = spec.it_interval;
+
+    if (::timerfd_settime(fd, 0, &spec, nullptr) != 0) {
+        ::close(fd);
+        return;
+    }
+    m_fd = fd;
+}
+
+timer_fd::~timer_fd() noexcept
+{
+    if (m_fd >= 0)
+        ::close(m_fd);
+}
+
+bool
+timer_fd::is_valid() const noexcept
+{
+    return m_fd >= 0;
+}
+
+io::result
+timer_fd::wait(io::timeout timeout) noexcept
+{
+    if (m_fd < 0)
+        return etl::unexpected{io::error::INVAL};
+
+    ::pollfd pfd{m_fd, POLLIN, 0};
+    int ret = ::poll(&pfd, 1, details::to_poll_ms(timeout));
+
+    if (ret == 0)
+        return etl::unexpected{io::error::TIMEOUT};
+    if (ret < 0)
+        return etl::unexpected{io::error::IO};
+
+    // Timer fd holds the number of expirations since the last read
+    uint64_t ticks = 0;
+    if (::read(m_fd, &ticks, sizeof(ticks)) != sizeof(ticks) || ticks == 0)
+        return etl::unexpected{io::error::IO};
+
+    return static_cast<size_t>(ticks);
+}
+
+}
@@ -1,6 +1,8 @@
 #include <emblib/posix/udp_dev.hpp>
 
 #include <arpa/inet.h>
+#include <cassert>
+#include <cstdio>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
@@ -0,0 +1,44 @@
+#include <emblib/posix/event_flags.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+
+using emblib::io::timeout;
+using wait_e = emblib::rtos::event_flags::wait_e;
+
+TEST_CASE("event_flags wait any and all", "[posix][event_flags]")
+{
+    emblib::posix::event_flags flags;
+
+    flags.set(0b0101);
+    REQUIRE(flags.get() == 0b0101);
+
+    // Only the matched flags are cleared
+    REQUIRE(flags.wait(0b0011, wait_e::ANY, timeout::min()) == 0b0001);
+    REQUIRE(flags.get() == 0b0100);
+
+    REQUIRE(flags.wait(0b0110, wait_e::ALL, timeout::min()) == 0);
+    flags.set(0b0010);
+    REQUIRE(flags.wait(0b0110, wait_e::ALL, timeout::min()) == 0b0110);
+    REQUIRE(flags.get() == 0);
+
+    flags.set(0b1000);
+    flags.clear(0b1000);
+    REQUIRE(flags.wait(0b1000, wait_e::ANY, timeout{10}) == 0);
+}
+
+TEST_CASE("event_flags wakes the waiter", "[posix][event_flags]")
+{
+    emblib::posix::event_flags flags;
+
+    std::thread setter([&flags] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        flags.set(0b01);
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        flags.set(0b10);
+    });
+
+    REQUIRE(flags.wait(0b11, wait_e::ALL, timeout::max()) == 0b11);
+    setter.join();
+}
@@ -0,0 +1,55 @@
+#include <emblib/posix/futex_wait.hpp>
+#include <emblib/lockfree/blocking_queue.hpp>
+#include <emblib/lockfree/spsc_queue.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+using emblib::io::timeout;
+using queue_t = emblib::lockfree::blocking_queue<emblib::lockfree::spsc_queue<int, 16>, emblib::posix::futex_wait>;
+
+TEST_CASE("futex_wait timeout", "[posix][futex_wait]")
+{
+    queue_t queue;
+    int item;
+
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(queue.pop_wait(item, timeout{20}));
+    REQUIRE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{20});
+
+    REQUIRE(queue.push(1));
+    REQUIRE((queue.pop_wait(item, timeout{20}) && item == 1));
+}
+
+TEST_CASE("futex_wait wakes parked consumer", "[posix][futex_wait]")
+{
+    // No spinning, so the consumer always parks on an empty queue
+    queue_t queue(0);
+
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        queue.push(42);
+    });
+
+    int item;
+    REQUIRE((queue.pop_wait(item, timeout::max()) && item == 42));
+    producer.join();
+}
+
+TEST_CASE("futex_wait producer and consumer", "[posix][futex_wait]")
+{
+    constexpr int ITEM_COUNT = 100000;
+    queue_t queue(10);
+
+    std::thread producer([&queue] {
+        for (int i = 0; i < ITEM_COUNT;) {
+            i += queue.push(i);
+        }
+    });
+
+    int item;
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        REQUIRE((queue.pop_wait(item, timeout{1000}) && item == i));
+    }
+    producer.join();
+}
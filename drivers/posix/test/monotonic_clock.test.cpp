@@ -0,0 +1,41 @@
+#include <emblib/posix/monotonic_clock.hpp>
+#include <emblib/rtos/cyclic_executive.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("monotonic_clock sleeps until absolute time", "[posix][monotonic_clock]")
+{
+    emblib::posix::monotonic_clock clock;
+
+    const auto start = clock.now();
+    clock.sleep_until(start + 5ms);
+    REQUIRE(clock.now() >= start + 5ms);
+
+    // Time in the past returns immediately
+    const auto before = clock.now();
+    clock.sleep_until(start);
+    REQUIRE(clock.now() - before < 5ms);
+}
+
+TEST_CASE("monotonic_clock drives cyclic executive", "[posix][monotonic_clock]")
+{
+    emblib::posix::monotonic_clock clock;
+    emblib::rtos::cyclic_executive<2> executive(clock);
+    size_t runs = 0;
+
+    auto task = [&] {
+        if (++runs == 20)
+            executive.stop();
+    };
+    const size_t index = executive.add_task(task, 1ms);
+
+    const auto start = clock.now();
+    executive.run();
+
+    // Released at the start and then every period
+    REQUIRE(clock.now() - start >= 19ms);
+    REQUIRE(executive.get_task_stats(index).get_metrics().get(decltype(executive)::task_stats::RUNS) == 20);
+}
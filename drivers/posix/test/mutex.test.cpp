@@ -0,0 +1,49 @@
+#include <emblib/posix/mutex.hpp>
+#include <emblib/posix/pi_mutex.hpp>
+#include <emblib/rtos/lock.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+TEST_CASE("mutex try_lock", "[posix][mutex]")
+{
+    emblib::posix::mutex mutex;
+
+    REQUIRE(mutex.try_lock());
+    REQUIRE_FALSE(mutex.try_lock());
+    mutex.unlock();
+
+    {
+        emblib::rtos::scoped_lock lock(mutex);
+        REQUIRE_FALSE(mutex.try_lock());
+    }
+    REQUIRE(mutex.try_lock());
+    mutex.unlock();
+}
+
+TEMPLATE_TEST_CASE("mutex mutual exclusion", "[posix][mutex][pi_mutex]",
+                   emblib::posix::mutex, emblib::posix::pi_mutex)
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t INCREMENT_COUNT = 10000;
+
+    TestType mutex;
+    size_t counter = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&mutex, &counter] {
+            for (size_t i = 0; i < INCREMENT_COUNT; i++) {
+                emblib::rtos::scoped_lock lock(mutex);
+                counter++;
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(counter == THREAD_COUNT * INCREMENT_COUNT);
+}
@@ -0,0 +1,108 @@
+#include <emblib/posix/pi_mutex.hpp>
+#include <emblib/posix/thread.hpp>
+#include <emblib/rtos/lock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+using clock_t_ = std::chrono::steady_clock;
+
+namespace {
+
+void spin_for(std::chrono::nanoseconds duration)
+{
+    const auto end = clock_t_::now() + duration;
+    while (clock_t_::now() < end) {}
+}
+
+/**
+ * Low, medium and high priority threads sharing a CPU, where the low and
+ * the high priority threads share the mutex
+ */
+struct inversion_s {
+    emblib::posix::pi_mutex mutex;
+    std::atomic<bool> is_locked{false};
+    clock_t_::time_point high_acquired;
+    clock_t_::time_point medium_done;
+
+    void low() noexcept
+    {
+        emblib::rtos::scoped_lock lock(mutex);
+        is_locked = true;
+        // Sleeping lets the other threads start while the mutex is held
+        std::this_thread::sleep_for(20ms);
+        spin_for(5ms);
+    }
+
+    void medium() noexcept
+    {
+        spin_for(200ms);
+        medium_done = clock_t_::now();
+    }
+
+    void high() noexcept
+    {
+        emblib::rtos::scoped_lock lock(mutex);
+        high_acquired = clock_t_::now();
+    }
+};
+
+emblib::rtos::thread_config_s pinned(int priority)
+{
+    emblib::rtos::thread_config_s config;
+    config.priority = priority;
+    config.affinity = 1 << 0;
+    return config;
+}
+
+using emblib::rtos::thread_fn_t;
+
+}
+
+TEST_CASE("pi_mutex try_lock", "[posix][pi_mutex]")
+{
+    emblib::posix::pi_mutex mutex;
+    REQUIRE(mutex.is_valid());
+
+    {
+        emblib::rtos::scoped_lock lock(mutex);
+        bool is_locked = true;
+        std::thread other([&mutex, &is_locked] {
+            is_locked = mutex.try_lock();
+        });
+        other.join();
+        REQUIRE_FALSE(is_locked);
+    }
+
+    REQUIRE(mutex.try_lock());
+    mutex.unlock();
+}
+
+TEST_CASE("pi_mutex bounds priority inversion", "[posix][pi_mutex]")
+{
+    inversion_s inversion;
+    REQUIRE(inversion.mutex.is_valid());
+
+    emblib::posix::thread low(thread_fn_t::create<inversion_s, &inversion_s::low>(inversion), pinned(10));
+    // Real-time scheduling needs privileges the test may not have
+    if (!low.is_valid())
+        SKIP("SCHED_FIFO not permitted");
+
+    while (!inversion.is_locked) {
+        std::this_thread::yield();
+    }
+
+    {
+        emblib::posix::thread high(thread_fn_t::create<inversion_s, &inversion_s::high>(inversion), pinned(30));
+        emblib::posix::thread medium(thread_fn_t::create<inversion_s, &inversion_s::medium>(inversion), pinned(20));
+        REQUIRE(high.is_valid());
+        REQUIRE(medium.is_valid());
+    }
+    low.join();
+
+    // Owner inherits the high priority, so the medium thread can't delay it
+    REQUIRE(inversion.high_acquired < inversion.medium_done);
+}
@@ -0,0 +1,62 @@
+#include <emblib/posix/semaphore.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using emblib::io::timeout;
+
+TEST_CASE("semaphore counts", "[posix][semaphore]")
+{
+    emblib::posix::semaphore semaphore(2);
+
+    REQUIRE(semaphore.get_count() == 2);
+    REQUIRE(semaphore.take(timeout::min()));
+    REQUIRE(semaphore.take(timeout::min()));
+    REQUIRE_FALSE(semaphore.take(timeout::min()));
+
+    semaphore.give();
+    REQUIRE(semaphore.get_count() == 1);
+    REQUIRE(semaphore.take(timeout::max()));
+}
+
+TEST_CASE("semaphore timeout", "[posix][semaphore]")
+{
+    emblib::posix::semaphore semaphore;
+
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(semaphore.take(timeout{20}));
+    REQUIRE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{20});
+}
+
+TEST_CASE("semaphore wakes waiting threads", "[posix][semaphore]")
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t TAKE_COUNT = 1000;
+
+    emblib::posix::semaphore semaphore;
+    std::atomic<size_t> taken(0);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < TAKE_COUNT; i++) {
+                // Failed takes are caught by the count checked after the joins
+                if (semaphore.take(timeout::max()))
+                    taken++;
+            }
+        });
+    }
+
+    for (size_t i = 0; i < THREAD_COUNT * TAKE_COUNT; i++) {
+        semaphore.give();
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(taken == THREAD_COUNT * TAKE_COUNT);
+    REQUIRE(semaphore.get_count() == 0);
+}
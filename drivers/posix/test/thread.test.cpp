@@ -0,0 +1,92 @@
+#include <emblib/posix/thread.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <pthread.h>
+#include <sched.h>
+
+namespace {
+
+struct probe_s {
+    std::atomic<bool> has_run{false};
+    const void* stack_address = nullptr;
+    int cpu = -1;
+    int policy = -1;
+
+    void run() noexcept
+    {
+        int local = 0;
+        stack_address = &local;
+        cpu = ::sched_getcpu();
+
+        sched_param param;
+        ::pthread_getschedparam(::pthread_self(), &policy, &param);
+        has_run = true;
+    }
+};
+
+using emblib::rtos::thread_fn_t;
+
+}
+
+TEST_CASE("thread runs and joins", "[posix][thread]")
+{
+    probe_s probe;
+    emblib::posix::thread thread(thread_fn_t::create<probe_s, &probe_s::run>(probe), {"probe"});
+
+    REQUIRE(thread.is_valid());
+    thread.join();
+    REQUIRE(probe.has_run);
+    REQUIRE(probe.policy == SCHED_OTHER);
+
+    // Joining again has no effect
+    thread.join();
+    REQUIRE_FALSE(thread.set_priority(0));
+}
+
+TEST_CASE("thread uses a static stack", "[posix][thread]")
+{
+    // Large enough for the sanitizers, which reserve part of the stack
+    alignas(64) static uint8_t stack[1024 * 1024];
+    probe_s probe;
+
+    {
+        emblib::rtos::thread_config_s config;
+        config.stack = stack;
+        emblib::posix::thread thread(thread_fn_t::create<probe_s, &probe_s::run>(probe), config);
+        REQUIRE(thread.is_valid());
+    }
+
+    REQUIRE(probe.has_run);
+    REQUIRE(probe.stack_address >= static_cast<const void*>(stack));
+    REQUIRE(probe.stack_address < static_cast<const void*>(stack + sizeof(stack)));
+}
+
+TEST_CASE("thread is pinned to a CPU", "[posix][thread]")
+{
+    probe_s probe;
+
+    {
+        emblib::rtos::thread_config_s config;
+        config.affinity = 1 << 0;
+        emblib::posix::thread thread(thread_fn_t::create<probe_s, &probe_s::run>(probe), config);
+        REQUIRE(thread.is_valid());
+    }
+
+    REQUIRE(probe.cpu == 0);
+}
+
+TEST_CASE("thread with real-time priority", "[posix][thread]")
+{
+    probe_s probe;
+    emblib::rtos::thread_config_s config;
+    config.priority = 10;
+    emblib::posix::thread thread(thread_fn_t::create<probe_s, &probe_s::run>(probe), config);
+
+    // Real-time scheduling needs privileges the test may not have
+    if (!thread.is_valid())
+        SKIP("SCHED_FIFO not permitted");
+
+    thread.join();
+    REQUIRE(probe.policy == SCHED_FIFO);
+}
@@ -0,0 +1,58 @@
+#include <emblib/posix/timer_fd.hpp>
+#include <emblib/rtos/timer_wheel.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+
+TEST_CASE("timer_fd counts ticks", "[posix][timer_fd]")
+{
+    emblib::posix::timer_fd timer{std::chrono::milliseconds{1}};
+
+    auto res = timer.wait(emblib::io::timeout{100});
+    REQUIRE(res);
+    REQUIRE(*res >= 1);
+
+    // Missed ticks are reported at once
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    res = timer.wait(emblib::io::timeout{100});
+    REQUIRE(res);
+    REQUIRE(*res >= 4);
+}
+
+TEST_CASE("timer_fd invalid period", "[posix][timer_fd]")
+{
+    emblib::posix::timer_fd timer{std::chrono::nanoseconds{0}};
+    REQUIRE_FALSE(timer.is_valid());
+
+    // Disarmed timer must not block forever
+    auto res = timer.wait(emblib::io::timeout::max());
+    REQUIRE_FALSE(res);
+    REQUIRE(res.error() == emblib::io::error::INVAL);
+}
+
+TEST_CASE("timer_fd timeout", "[posix][timer_fd]")
+{
+    emblib::posix::timer_fd timer{std::chrono::seconds{10}};
+
+    auto res = timer.wait(emblib::io::timeout{1});
+    REQUIRE_FALSE(res);
+    REQUIRE(res.error() == emblib::io::error::TIMEOUT);
+}
+
+TEST_CASE("timer_fd drives timer wheel", "[posix][timer_fd]")
+{
+    emblib::posix::timer_fd timer{std::chrono::milliseconds{1}};
+    emblib::rtos::timer_wheel<8> wheel;
+
+    size_t fired = 0;
+    auto on_expire = [&fired] { fired++; };
+    wheel.start(3, on_expire, 3);
+
+    while (wheel.get_time() < 20) {
+        auto res = timer.wait(emblib::io::timeout{100});
+        REQUIRE(res);
+        wheel.advance(*res);
+    }
+    REQUIRE(fired >= 6);
+}
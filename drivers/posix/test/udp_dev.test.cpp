@@ -1,6 +1,8 @@
 #include <emblib/posix/udp_dev.hpp>
 
 #include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <thread>
 
 
 TEST_CASE("udp_dev write and read", "[posix][udp]")
@@ -61,4 +63,23 @@ TEST_CASE("udp_dev abort async read", "[posix][udp]")
     REQUIRE(dev2.abort_async_read());
     std::this_thread::sleep_for(std::chrono::milliseconds{1});
     REQUIRE(read_res.error() == emblib::io::error::ABORT);
-}
\ No newline at end of file
+}
+
+TEST_CASE("udp_dev metrics", "[posix][udp]")
+{
+    using emblib::posix::sock_dev;
+    emblib::posix::udp_dev dev1{"localhost", 25565, 25566};
+    emblib::posix::udp_dev dev2{"localhost", 25566, 25565};
+
+    std::array<uint8_t, 8> test_data = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::array<uint8_t, 10> read_buf;
+    REQUIRE(dev1.write(test_data, emblib::io::timeout{1}));
+    REQUIRE(dev2.read(read_buf, emblib::io::timeout{1}));
+    REQUIRE_FALSE(dev2.read(read_buf, emblib::io::timeout{1}));
+
+    if constexpr (emblib::metrics::IS_ENABLED) {
+        REQUIRE(dev1.get_metrics().get(sock_dev::TX_BYTES) == sizeof(test_data));
+        REQUIRE(dev2.get_metrics().get(sock_dev::RX_BYTES) == sizeof(test_data));
+        REQUIRE(dev2.get_metrics().get(sock_dev::TIMEOUTS) == 1);
+    }
+}
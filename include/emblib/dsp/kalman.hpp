@@ -7,6 +7,9 @@ namespace emblib::dsp {
 
 /**
  * Kalman filter
+ * @note State and covariance are stored by value, so with a vectorized matrix
+ * backend the filter has the alignment of its matrices. Buffers used to
+ * construct it in place should be declared with `alignas(kalman)`.
  */
 template <size_t STATE_DIM, typename scalar_type = float>
 class kalman {
@@ -21,7 +24,7 @@ public:
         m_p(0)
     {}
 
-    explicit kalman(vec_t<STATE_DIM> initial_state) noexcept :
+    explicit kalman(const vec_t<STATE_DIM>& initial_state) noexcept :
         m_state(initial_state),
         m_p(0)
     {}
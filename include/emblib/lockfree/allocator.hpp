@@ -1,34 +1,144 @@
 #pragma once
 
+#include "cache_line.hpp"
+#include "emblib/metrics/counters.hpp"
+#include <etl/span.h>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace emblib::lockfree {
 
 /**
  * Lock-free thread safe allocation from a pre-allocated buffer
+ *
+ * @note Free blocks are linked by index, and the head of the free list
+ * packs the index of the first block with a tag which is incremented on
+ * every change of the list. This prevents the ABA problem, since a stale
+ * head never compares equal to the current one.
  */
 template<typename data_type, size_t CAPACITY>
 class allocator {
+    static_assert(CAPACITY > 0 && CAPACITY < UINT32_MAX);
+
     union block_u {
-        uint8_t data[sizeof(data_type)];
-        block_u* next;
+        alignas(data_type) uint8_t data[sizeof(data_type)];
+        uint32_t next;
+    };
+
+    /**
+     * Index marking the end of the free list
+     */
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    struct alignas(CACHE_LINE_SIZE) allocated_count_s {
+        std::atomic<size_t> value;
+    };
+
+    struct null_allocated_count_s {};
+
+public:
+    /**
+     * Indices of the allocator metrics, collected if metrics are enabled
+     */
+    enum metric_e : size_t {
+        ALLOCATED,
+        ALLOC_FAILED,
+        METRIC_COUNT
+    };
+
+    static constexpr const char* METRIC_NAMES[METRIC_COUNT] = {"allocated", "alloc_failed"};
+
+    /**
+     * Thread local cache of free blocks
+     *
+     * Blocks are taken from and returned to the allocator in batches of
+     * half the magazine size, which reduces the traffic on the shared free
+     * list when a thread allocates and deallocates often.
+     *
+     * @note A magazine must only be used by a single thread. Blocks held by
+     * the magazine are counted as allocated by the allocator.
+     */
+    template <size_t MAGAZINE_SIZE>
+    class magazine {
+        static_assert(MAGAZINE_SIZE >= 2);
+        static constexpr size_t BATCH_SIZE = MAGAZINE_SIZE / 2;
+
+    public:
+        explicit magazine(allocator& allocator) noexcept :
+            m_allocator(allocator),
+            m_count(0)
+        {}
+
+        ~magazine() noexcept
+        {
+            flush();
+        }
+
+        magazine(const magazine&) = delete;
+        magazine& operator=(const magazine&) = delete;
+        magazine(magazine&&) = delete;
+        magazine& operator=(magazine&&) = delete;
+
+        /**
+         * Allocate an empty slot
+         * @returns Pointer to the allocated memory if there was any available,
+         * else `nullptr`
+         */
+        data_type* alloc() noexcept
+        {
+            if (m_count == 0) {
+                m_count = m_allocator.alloc_n({m_blocks, BATCH_SIZE});
+                if (m_count == 0) {
+                    return nullptr;
+                }
+            }
+            return m_blocks[--m_count];
+        }
+
+        /**
+         * Deallocate a slot
+         * @note The provided pointer must originate from the allocator
+         * this magazine was created for
+         */
+        void dealloc(data_type* ptr) noexcept
+        {
+            if (m_count == MAGAZINE_SIZE) {
+                m_count -= BATCH_SIZE;
+                m_allocator.dealloc_n({m_blocks + m_count, BATCH_SIZE});
+            }
+            m_blocks[m_count++] = ptr;
+        }
+
+        /**
+         * Return all cached blocks to the allocator
+         */
+        void flush() noexcept
+        {
+            m_allocator.dealloc_n({m_blocks, m_count});
+            m_count = 0;
+        }
+
+    private:
+        allocator& m_allocator;
+        size_t m_count;
+        data_type* m_blocks[MAGAZINE_SIZE];
     };
-    
+
 public:
     allocator() :
-        m_available_head(nullptr),
-        m_allocated_count(0)
+        m_available_head(0),
+        m_allocated_count{}
     {
         reset();
     }
-    
+
     allocator(const allocator&) = delete;
     allocator& operator=(const allocator&) = delete;
     allocator(allocator&&) = delete;
     allocator& operator=(allocator&&) = delete;
-    
+
     /**
      * Allocate an empty slot
      * @note Allocated buffer is not initialized
@@ -37,26 +147,71 @@ public:
      */
     data_type* alloc() noexcept
     {
-        block_u* old_head = m_available_head.load(std::memory_order_acquire);
+        uint64_t old_head = m_available_head.load(std::memory_order_acquire);
 
-        while (old_head != nullptr) {
-            block_u* new_head = old_head->next;
+        while (get_index(old_head) != NONE) {
+            const uint32_t index = get_index(old_head);
+            const uint64_t new_head = make_head(get_block(index).next, old_head);
 
-            // Try to atomically update head pointer
+            // Try to atomically update head, fails if the list changed in the meantime
             if (m_available_head.compare_exchange_weak(old_head, new_head,
-                                               std::memory_order_release,
+                                               std::memory_order_acquire,
                                                std::memory_order_acquire)) {
-                m_allocated_count.fetch_add(1, std::memory_order_relaxed);
-                return reinterpret_cast<data_type*>(old_head);
+                add_allocated(1);
+                return reinterpret_cast<data_type*>(&get_block(index));
             }
             // Compare and swap failed, old_head was updated by compare_exchange_weak
             // Loop will retry with new value
         }
-        
-        // If old_head (m_available_head) is nullptr, the entire buffer is allocated
+
+        // If old_head (m_available_head) is empty, the entire buffer is allocated
+        m_metrics.add(ALLOC_FAILED);
         return nullptr;
     }
-    
+
+    /**
+     * Allocate multiple empty slots with a single update of the free list
+     * @returns Number of slots allocated, written to the start of the span
+     */
+    size_t alloc_n(etl::span<data_type*> ptrs) noexcept
+    {
+        if (ptrs.empty()) {
+            return 0;
+        }
+
+        uint64_t old_head = m_available_head.load(std::memory_order_acquire);
+        size_t count;
+
+        do {
+            uint32_t index = get_index(old_head);
+            count = 0;
+
+            // Blocks may be taken by another thread during the walk, so the
+            // next index is bounds checked, but CAS will fail in that case
+            while (index != NONE && count < ptrs.size()) {
+                ptrs[count++] = reinterpret_cast<data_type*>(&get_block(index));
+                index = get_block(index).next;
+                if (index >= CAPACITY) {
+                    index = NONE;
+                }
+            }
+
+            if (count == 0) {
+                m_metrics.add(ALLOC_FAILED);
+                return 0;
+            }
+
+            if (m_available_head.compare_exchange_weak(old_head, make_head(index, old_head),
+                                                       std::memory_order_acquire,
+                                                       std::memory_order_acquire)) {
+                break;
+            }
+        } while (true);
+
+        add_allocated(count);
+        return count;
+    }
+
     /**
      * Deallocate a slot
      * @note The provided pointer must originate from the `alloc` method of this
@@ -64,41 +219,68 @@ public:
      */
     void dealloc(data_type* ptr) noexcept
     {
-        block_u* block = reinterpret_cast<block_u*>(ptr);
-        block_u* old_head = m_available_head.load(std::memory_order_acquire);
-        
-        do {
-            block->next = old_head;
-            // Try to atomically push block onto free list
-        } while (!m_available_head.compare_exchange_weak(
-            old_head, block, std::memory_order_release, std::memory_order_acquire
-        ));
-        
-        m_allocated_count.fetch_sub(1, std::memory_order_relaxed);
+        const uint32_t index = get_block_index(ptr);
+        push_chain(index, get_block(index));
+        sub_allocated(1);
+    }
+
+    /**
+     * Deallocate multiple slots with a single update of the free list
+     * @note Same as for `dealloc`, all pointers must originate from this object
+     */
+    void dealloc_n(etl::span<data_type* const> ptrs) noexcept
+    {
+        if (ptrs.empty()) {
+            return;
+        }
+
+        // Link the blocks into a chain before publishing it
+        for (size_t i = 0; i + 1 < ptrs.size(); i++) {
+            get_block(get_block_index(ptrs[i])).next = get_block_index(ptrs[i + 1]);
+        }
+
+        push_chain(get_block_index(ptrs.front()), get_block(get_block_index(ptrs.back())));
+        sub_allocated(ptrs.size());
     }
-    
+
     /**
      * Reset the allocator
      * @note Make sure none of the blocks are in use
      */
     void reset() noexcept
     {
-        block_u* blocks = reinterpret_cast<block_u*>(m_buffer);
-        
-        for (size_t i = 0; i < CAPACITY; ++i) {
-            blocks[i].next = (i < CAPACITY - 1) ? &blocks[i + 1] : nullptr;
+        for (uint32_t i = 0; i < CAPACITY; ++i) {
+            get_block(i).next = (i < CAPACITY - 1) ? i + 1 : NONE;
         }
-        
-        m_available_head.store(blocks, std::memory_order_release);
-        m_allocated_count.store(0, std::memory_order_relaxed);
+
+        const uint64_t old_head = m_available_head.load(std::memory_order_relaxed);
+        m_available_head.store(make_head(0, old_head), std::memory_order_release);
+        sub_allocated(get_allocation_count());
+    }
+
+    /**
+     * Check if the pointer points into the buffer of this allocator
+     */
+    bool is_owner_of(const void* ptr) const noexcept
+    {
+        auto byte_ptr = static_cast<const uint8_t*>(ptr);
+        return byte_ptr >= m_buffer && byte_ptr < m_buffer + sizeof(m_buffer);
     }
 
     /**
      * Get the number of allocated nodes
+     * @note Summed from the `ALLOCATED` metric if metrics are enabled, which
+     * is only exact while no other thread allocates or deallocates
      */
     size_t get_allocation_count() const noexcept
     {
-        return m_allocated_count.load(std::memory_order_relaxed);
+        if constexpr (metrics::IS_ENABLED) {
+            // Shards are read one by one, so a dealloc may be seen before its alloc
+            const int64_t count = m_metrics.get(ALLOCATED);
+            return count > 0 ? static_cast<size_t>(count) : 0;
+        } else {
+            return m_allocated_count.value.load(std::memory_order_relaxed);
+        }
     }
 
     /**
@@ -109,14 +291,88 @@ public:
         return CAPACITY;
     }
 
+    /**
+     * Get the metrics, indexed by `metric_e`
+     */
+    const metrics::counters<METRIC_COUNT>& get_metrics() const noexcept
+    {
+        return m_metrics;
+    }
+
+private:
+    block_u& get_block(uint32_t index) noexcept
+    {
+        return reinterpret_cast<block_u*>(m_buffer)[index];
+    }
+
+    /**
+     * Count allocated nodes in the `ALLOCATED` metric if metrics are enabled,
+     * so the hot path only updates a per thread shard
+     */
+    void add_allocated(size_t count) noexcept
+    {
+        if constexpr (metrics::IS_ENABLED) {
+            m_metrics.add(ALLOCATED, static_cast<int64_t>(count));
+        } else {
+            m_allocated_count.value.fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+
+    void sub_allocated(size_t count) noexcept
+    {
+        if constexpr (metrics::IS_ENABLED) {
+            m_metrics.sub(ALLOCATED, static_cast<int64_t>(count));
+        } else {
+            m_allocated_count.value.fetch_sub(count, std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t get_block_index(const data_type* ptr) const noexcept
+    {
+        auto offset = reinterpret_cast<const uint8_t*>(ptr) - m_buffer;
+        return static_cast<uint32_t>(offset / sizeof(block_u));
+    }
+
+    /**
+     * Push a chain of linked blocks onto the free list
+     */
+    void push_chain(uint32_t first, block_u& last) noexcept
+    {
+        uint64_t old_head = m_available_head.load(std::memory_order_relaxed);
+
+        do {
+            last.next = get_index(old_head);
+        } while (!m_available_head.compare_exchange_weak(
+            old_head, make_head(first, old_head), std::memory_order_release, std::memory_order_relaxed
+        ));
+    }
+
+    static uint32_t get_index(uint64_t head) noexcept
+    {
+        return static_cast<uint32_t>(head);
+    }
+
+    /**
+     * Create a new head pointing to the index, with the tag
+     * incremented from the old head
+     */
+    static uint64_t make_head(uint32_t index, uint64_t old_head) noexcept
+    {
+        const uint64_t tag = (old_head >> 32) + 1;
+        return (tag << 32) | index;
+    }
+
 private:
     // Pre-allocated m_buffer for all blocks
     alignas(block_u) uint8_t m_buffer[sizeof(block_u) * CAPACITY];
-    
-    // Lock-free stack head using atomic pointer
-    std::atomic<block_u*> m_available_head;
-    // Not required - used to fetch allocation count in O(1)
-    std::atomic<size_t> m_allocated_count;
+
+    // Lock-free stack head, tag in the upper and index in the lower half
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_available_head;
+    // Used to fetch allocation count in O(1), the `ALLOCATED` metric replaces it if enabled
+    std::conditional_t<metrics::IS_ENABLED, null_allocated_count_s, allocated_count_s> m_allocated_count;
+
+    // Sharded per thread, empty if metrics are disabled
+    EMBLIB_NO_UNIQUE_ADDRESS metrics::counters<METRIC_COUNT> m_metrics;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace emblib::lockfree {
+
+/**
+ * Hint to the CPU that the calling thread is spinning, which saves power
+ * and frees resources for the other hardware thread on the same core
+ */
+inline void cpu_relax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__ARM_ARCH_7A__) || defined(__ARM_ARCH_8A__)
+    __asm__ volatile("yield");
+#endif
+}
+
+/**
+ * Bounded exponential backoff for spin loops
+ *
+ * Every call to `pause` spins twice as long as the previous one, up to
+ * `max_spins` pause hints. Spreading out retries of contending threads
+ * reduces the traffic on the contended cache line.
+ */
+class backoff {
+public:
+    static constexpr uint32_t DEFAULT_MAX_SPINS = 1024;
+
+    explicit backoff(uint32_t max_spins = DEFAULT_MAX_SPINS) noexcept :
+        m_spins(1),
+        m_max_spins(max_spins)
+    {}
+
+    /**
+     * Spin for the current backoff period and double it
+     */
+    void pause() noexcept
+    {
+        for (uint32_t i = 0; i < m_spins; i++) {
+            cpu_relax();
+        }
+        m_spins = std::min(m_spins * 2, m_max_spins);
+    }
+
+    /**
+     * Start again from the shortest period
+     */
+    void reset() noexcept
+    {
+        m_spins = 1;
+    }
+
+private:
+    uint32_t m_spins;
+    uint32_t m_max_spins;
+};
+
+}
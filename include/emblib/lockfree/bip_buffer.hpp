@@ -0,0 +1,150 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include <etl/span.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::lockfree {
+
+/**
+ * Lock-free Single Producer Single Consumer bipartite byte buffer
+ *
+ * Writer reserves a contiguous region, fills it in place (for example with
+ * `io::idev::read`) and commits the number of bytes actually written. Reader
+ * gets the contiguous region of committed bytes, uses it in place (for example
+ * with `io::odev::write`) and releases the number of bytes consumed.
+ *
+ * Instead of splitting a region at the end of the buffer, the writer wraps
+ * around to the start and marks where the valid data in the upper part ends.
+ * That way every region handed out is contiguous, at the cost of the unused
+ * space at the end of the buffer while wrapped.
+ */
+template <size_t CAPACITY>
+class bip_buffer {
+    static_assert(CAPACITY > 0);
+
+public:
+    bip_buffer() :
+        m_read(0),
+        m_write(0),
+        m_last(CAPACITY),
+        m_reserve_start(0),
+        m_reserve_size(0)
+    {}
+
+    bip_buffer(const bip_buffer&) = delete;
+    bip_buffer& operator=(const bip_buffer&) = delete;
+    bip_buffer(bip_buffer&&) = delete;
+    bip_buffer& operator=(bip_buffer&&) = delete;
+
+    /**
+     * Reserve a contiguous region of exactly `size` bytes for writing
+     * @returns Reserved region, empty if there isn't enough contiguous space
+     * @note Only the writer may call this method. Reserving again discards
+     * the previous reservation if it wasn't committed.
+     */
+    etl::span<uint8_t> reserve(size_t size) noexcept
+    {
+        const size_t write = m_write.load(std::memory_order_relaxed);
+        const size_t read = m_read.load(std::memory_order_acquire);
+
+        if (size == 0)
+            return {};
+
+        if (write >= read) {
+            if (CAPACITY - write >= size) {
+                m_reserve_start = write;
+            } else if (read > size) {
+                // Wrap around, keeping at least one byte between write and read
+                m_reserve_start = 0;
+            } else {
+                return {};
+            }
+        } else if (read - write > size) {
+            m_reserve_start = write;
+        } else {
+            return {};
+        }
+
+        m_reserve_size = size;
+        return {m_buffer + m_reserve_start, size};
+    }
+
+    /**
+     * Publish the first `size` bytes of the last reservation
+     * @note `size` must not be greater than the size of the reservation
+     */
+    void commit(size_t size) noexcept
+    {
+        if (size == 0 || size > m_reserve_size)
+            return;
+
+        const size_t write = m_write.load(std::memory_order_relaxed);
+
+        // Mark the end of the data in the upper part before wrapping around
+        if (m_reserve_start != write)
+            m_last.store(write, std::memory_order_relaxed);
+
+        m_reserve_size = 0;
+        m_write.store(m_reserve_start + size, std::memory_order_release);
+    }
+
+    /**
+     * Get the contiguous region of committed bytes
+     * @returns Region starting at the oldest committed byte, empty if there
+     * is nothing to read. If the data wraps around the buffer end, only the
+     * upper part is returned, and the rest after it is released.
+     * @note Only the reader may call this method
+     */
+    etl::span<const uint8_t> read() noexcept
+    {
+        const size_t write = m_write.load(std::memory_order_acquire);
+        size_t read = m_read.load(std::memory_order_relaxed);
+
+        if (write >= read)
+            return {m_buffer + read, write - read};
+
+        // Writer has wrapped around, continue from the start once the upper part is read
+        const size_t last = m_last.load(std::memory_order_relaxed);
+        if (read < last)
+            return {m_buffer + read, last - read};
+
+        read = 0;
+        m_read.store(read, std::memory_order_release);
+        return {m_buffer, write};
+    }
+
+    /**
+     * Free the first `size` bytes of the region returned by `read`
+     * @note `size` must not be greater than the size of that region
+     */
+    void release(size_t size) noexcept
+    {
+        const size_t read = m_read.load(std::memory_order_relaxed);
+        m_read.store(read + size, std::memory_order_release);
+    }
+
+    /**
+     * Get capacity
+     */
+    constexpr size_t get_capacity() const noexcept
+    {
+        return CAPACITY;
+    }
+
+private:
+    uint8_t m_buffer[CAPACITY];
+
+    // Reader owned cache line
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_read;
+
+    // Writer owned cache line
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_write;
+    std::atomic<size_t> m_last;
+    size_t m_reserve_start;
+    size_t m_reserve_size;
+};
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "wait_strategy.hpp"
+#include "emblib/io/types.hpp"
+#include <type_traits>
+#include <utility>
+
+namespace emblib::lockfree {
+
+/**
+ * Lock-free queue with consumers which can wait for items
+ *
+ * Wraps one of the lock-free queues, and notifies the wait strategy
+ * after every push. Taking an item first tries the queue directly, so
+ * waiting only costs anything once the queue is empty.
+ *
+ * @note `wait_type` is one of `spin_wait`, `yield_wait` or a blocking
+ * strategy of the platform, such as `posix::futex_wait`
+ */
+template <typename queue_type, typename wait_type>
+class blocking_queue {
+public:
+    template <typename... Args>
+    explicit blocking_queue(Args&&... wait_args) noexcept :
+        m_wait(std::forward<Args>(wait_args)...)
+    {}
+
+    blocking_queue(const blocking_queue&) = delete;
+    blocking_queue& operator=(const blocking_queue&) = delete;
+    blocking_queue(blocking_queue&&) = delete;
+    blocking_queue& operator=(blocking_queue&&) = delete;
+
+    /**
+     * Push an item and wake up the waiting consumers
+     * @returns Same as the `push` of the queue
+     */
+    template <typename item_type>
+    auto push(const item_type& item) noexcept
+    {
+        if constexpr (std::is_void_v<decltype(m_queue.push(item))>) {
+            m_queue.push(item);
+            m_wait.notify();
+        } else {
+            const auto result = m_queue.push(item);
+            if (result)
+                m_wait.notify();
+            return result;
+        }
+    }
+
+    /**
+     * Pop an item, waiting up to `timeout` for one to be pushed
+     * @returns `false` if the queue was still empty at timeout
+     */
+    template <typename item_type>
+    bool pop_wait(item_type& item_buffer, io::timeout timeout) noexcept
+    {
+        if (m_queue.pop(item_buffer))
+            return true;
+
+        auto try_pop = [this, &item_buffer] { return m_queue.pop(item_buffer); };
+        return m_wait.wait(try_pop, timeout);
+    }
+
+    /**
+     * Read an item with a reader of a broadcast queue (`spmc_queue`),
+     * waiting up to `timeout` for one to be pushed
+     * @returns `false` if there was no new item at timeout
+     */
+    template <typename reader_type, typename item_type>
+    bool read_wait(reader_type& reader, item_type& item_buffer, io::timeout timeout) noexcept
+    {
+        if (reader.read(item_buffer))
+            return true;
+
+        auto try_read = [&reader, &item_buffer] { return reader.read(item_buffer); };
+        return m_wait.wait(try_read, timeout);
+    }
+
+    /**
+     * Wake up the waiting consumers after pushing directly into the queue,
+     * for example with `push_n` or `commit`
+     */
+    void notify() noexcept
+    {
+        m_wait.notify();
+    }
+
+    /**
+     * Get the underlying queue
+     */
+    queue_type& get_queue() noexcept
+    {
+        return m_queue;
+    }
+
+private:
+    queue_type m_queue;
+    wait_type m_wait;
+};
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace emblib::lockfree {
+
+/**
+ * Size of the destructive interference range used to separate
+ * variables written by different cores
+ * @note Can be overridden by defining `EMBLIB_CACHE_LINE_SIZE`
+ */
+#ifdef EMBLIB_CACHE_LINE_SIZE
+constexpr size_t CACHE_LINE_SIZE = EMBLIB_CACHE_LINE_SIZE;
+#else
+constexpr size_t CACHE_LINE_SIZE = 64;
+#endif
+
+}
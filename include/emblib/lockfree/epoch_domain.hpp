@@ -0,0 +1,293 @@
+#pragma once
+
+#include "allocator.hpp"
+#include "cache_line.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::lockfree {
+
+/**
+ * Epoch based reclamation of memory shared between threads
+ *
+ * Readers access shared nodes only while pinned, which announces the global
+ * epoch they observed. Nodes unlinked from a structure are retired instead
+ * of freed, into a list of the retiring thread tagged with the current epoch.
+ * The global epoch only advances once all pinned threads have observed it, so
+ * nodes retired two epochs ago can't be referenced by anyone and are freed.
+ *
+ * Readers never write to shared memory other than their own epoch, so lookups
+ * scale with the number of readers. The epoch is only advanced by threads
+ * retiring nodes, and reclamation is delayed while any thread stays pinned,
+ * so critical sections should be short.
+ *
+ * @note Each thread using the domain must first register as a `participant`,
+ * and at most MAX_THREADS threads can be registered at the same time
+ */
+template <size_t MAX_THREADS, size_t RETIRE_CAPACITY = 64>
+class epoch_domain {
+    static_assert(MAX_THREADS > 0 && RETIRE_CAPACITY > 0);
+
+    /**
+     * Number of retire lists, nodes are freed two epochs after being retired
+     */
+    static constexpr size_t EPOCH_COUNT = 3;
+    static constexpr uint64_t ACTIVE = 1;
+
+    struct retired_s {
+        void* ptr;
+        void (*free_fn)(void* context, void* ptr);
+        void* context;
+    };
+
+    struct retire_list_s {
+        uint64_t epoch;
+        size_t count;
+        retired_s items[RETIRE_CAPACITY];
+    };
+
+    struct alignas(CACHE_LINE_SIZE) thread_s {
+        // Observed epoch shifted left, with the lowest bit set while pinned
+        std::atomic<uint64_t> local_epoch;
+        std::atomic<bool> is_registered;
+        // Owned by the registered thread
+        retire_list_s retired[EPOCH_COUNT];
+    };
+
+public:
+    class participant;
+
+    /**
+     * Keeps the participant pinned while in scope
+     */
+    class guard {
+    public:
+        explicit guard(participant& participant) noexcept :
+            m_participant(participant)
+        {
+            m_participant.pin();
+        }
+
+        ~guard() noexcept
+        {
+            m_participant.unpin();
+        }
+
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+        guard(guard&&) = delete;
+        guard& operator=(guard&&) = delete;
+
+    private:
+        participant& m_participant;
+    };
+
+    /**
+     * Registration of a thread with the domain
+     *
+     * @note Must only be used by the thread which created it. Nodes retired
+     * but not yet freed when it's destroyed are freed by the next participant
+     * registered in the same slot, or by the domain destructor.
+     */
+    class participant {
+    public:
+        explicit participant(epoch_domain& domain) noexcept :
+            m_domain(domain),
+            m_thread(domain.register_thread()),
+            m_pin_depth(0)
+        {}
+
+        ~participant() noexcept
+        {
+            if (m_thread != nullptr)
+                m_thread->is_registered.store(false, std::memory_order_release);
+        }
+
+        participant(const participant&) = delete;
+        participant& operator=(const participant&) = delete;
+        participant(participant&&) = delete;
+        participant& operator=(participant&&) = delete;
+
+        /**
+         * Check if the registration succeeded
+         * @note Fails if MAX_THREADS participants are already registered
+         */
+        bool is_valid() const noexcept
+        {
+            return m_thread != nullptr;
+        }
+
+        /**
+         * Enter a critical section, until `unpin` is called shared nodes
+         * observed by this thread won't be freed
+         * @note Pins can be nested
+         */
+        void pin() noexcept
+        {
+            if (m_pin_depth++ > 0)
+                return;
+
+            const uint64_t epoch = m_domain.m_global_epoch.load(std::memory_order_relaxed);
+            m_thread->local_epoch.store((epoch << 1) | ACTIVE, std::memory_order_relaxed);
+            // Announce the epoch before reading any shared node
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        /**
+         * Leave the critical section
+         */
+        void unpin() noexcept
+        {
+            if (--m_pin_depth > 0)
+                return;
+            m_thread->local_epoch.store(0, std::memory_order_release);
+        }
+
+        /**
+         * Free `ptr` by calling `free_fn(context, ptr)` once no thread
+         * can reference it anymore
+         * @returns `false` if the retire list of the current epoch is full,
+         * in which case the node should be retired again after unpinning
+         */
+        bool retire(void* ptr, void (*free_fn)(void*, void*), void* context) noexcept
+        {
+            uint64_t epoch = m_domain.m_global_epoch.load(std::memory_order_acquire);
+            retire_list_s* list = &get_list(epoch);
+
+            if (list->count == RETIRE_CAPACITY) {
+                m_domain.try_advance(epoch);
+                epoch = m_domain.m_global_epoch.load(std::memory_order_acquire);
+                list = &get_list(epoch);
+                if (list->count == RETIRE_CAPACITY)
+                    return false;
+            }
+
+            list->items[list->count++] = {ptr, free_fn, context};
+            collect();
+            return true;
+        }
+
+        /**
+         * Return `ptr` to the allocator once no thread can reference it anymore
+         * @note Object is not destroyed, the same as with `allocator::dealloc`
+         */
+        template <typename data_type, size_t CAPACITY>
+        bool retire(allocator<data_type, CAPACITY>& allocator, data_type* ptr) noexcept
+        {
+            auto free_fn = [](void* context, void* node) {
+                using allocator_t = lockfree::allocator<data_type, CAPACITY>;
+                static_cast<allocator_t*>(context)->dealloc(static_cast<data_type*>(node));
+            };
+            return retire(ptr, free_fn, &allocator);
+        }
+
+        /**
+         * Try to advance the epoch and free the nodes retired by this
+         * thread which became safe
+         * @note Called on every retire, a thread which stops retiring
+         * can call it to free its remaining nodes
+         */
+        void collect() noexcept
+        {
+            uint64_t epoch = m_domain.m_global_epoch.load(std::memory_order_acquire);
+            if (m_domain.try_advance(epoch))
+                epoch++;
+
+            for (auto& list : m_thread->retired) {
+                if (list.count > 0 && list.epoch + 2 <= epoch)
+                    free_list(list);
+            }
+        }
+
+    private:
+        /**
+         * Get the retire list for the epoch, freeing its old nodes
+         * if it was last used for an earlier epoch
+         */
+        retire_list_s& get_list(uint64_t epoch) noexcept
+        {
+            retire_list_s& list = m_thread->retired[epoch % EPOCH_COUNT];
+            if (list.epoch != epoch) {
+                free_list(list);
+                list.epoch = epoch;
+            }
+            return list;
+        }
+
+    private:
+        epoch_domain& m_domain;
+        thread_s* m_thread;
+        size_t m_pin_depth;
+    };
+
+public:
+    epoch_domain() noexcept :
+        m_global_epoch(0),
+        m_threads{}
+    {}
+
+    /**
+     * Free all the retired nodes
+     * @note No thread may be accessing the nodes anymore
+     */
+    ~epoch_domain() noexcept
+    {
+        for (auto& thread : m_threads) {
+            for (auto& list : thread.retired) {
+                free_list(list);
+            }
+        }
+    }
+
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+    epoch_domain(epoch_domain&&) = delete;
+    epoch_domain& operator=(epoch_domain&&) = delete;
+
+    /**
+     * Get the current global epoch
+     */
+    uint64_t get_epoch() const noexcept
+    {
+        return m_global_epoch.load(std::memory_order_acquire);
+    }
+
+private:
+    thread_s* register_thread() noexcept
+    {
+        for (auto& thread : m_threads) {
+            bool expected = false;
+            if (thread.is_registered.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return &thread;
+        }
+        return nullptr;
+    }
+
+    /**
+     * Advance the global epoch if all pinned threads have observed it
+     */
+    bool try_advance(uint64_t epoch) noexcept
+    {
+        for (const auto& thread : m_threads) {
+            const uint64_t local = thread.local_epoch.load(std::memory_order_seq_cst);
+            if ((local & ACTIVE) && (local >> 1) != epoch)
+                return false;
+        }
+        return m_global_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel);
+    }
+
+    static void free_list(retire_list_s& list) noexcept
+    {
+        for (size_t i = 0; i < list.count; i++) {
+            list.items[i].free_fn(list.items[i].context, list.items[i].ptr);
+        }
+        list.count = 0;
+    }
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_global_epoch;
+    thread_s m_threads[MAX_THREADS];
+};
+
+}
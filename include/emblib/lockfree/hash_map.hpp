@@ -0,0 +1,197 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace emblib::lockfree {
+
+/**
+ * Fixed capacity concurrent hash map with integer keys
+ *
+ * Open addressing with linear probing, where each key is claimed with a
+ * single CAS on an empty bucket and stays in it for the lifetime of the map.
+ * Erasing a key leaves a tombstone which is revived if the key is inserted
+ * again, so probe sequences never change and lookups need no locks or retries.
+ *
+ * Lookups are wait-free and inserts and erases are lock-free, from any
+ * number of threads.
+ *
+ * @note Key equal to `EMPTY_KEY` is reserved. Buckets are never released,
+ * so the number of distinct keys ever inserted must not exceed the capacity.
+ * Values are stored in atomics, so they should be small trivially copyable
+ * types such as pointers or indices.
+ */
+template <typename key_type, typename value_type, size_t CAPACITY, key_type EMPTY_KEY = key_type(~key_type(0))>
+class hash_map {
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of 2");
+    static_assert(std::is_integral_v<key_type>);
+    static_assert(std::atomic<key_type>::is_always_lock_free);
+    static_assert(std::atomic<value_type>::is_always_lock_free);
+
+    static constexpr size_t MASK = CAPACITY - 1;
+
+    enum class state_e : uint8_t {
+        EMPTY,
+        PRESENT,
+        ERASED
+    };
+
+    struct bucket_s {
+        std::atomic<key_type> key;
+        std::atomic<state_e> state;
+        std::atomic<value_type> value;
+    };
+
+public:
+    hash_map() noexcept
+    {
+        for (auto& bucket : m_buckets) {
+            bucket.key.store(EMPTY_KEY, std::memory_order_relaxed);
+            bucket.state.store(state_e::EMPTY, std::memory_order_relaxed);
+        }
+    }
+
+    hash_map(const hash_map&) = delete;
+    hash_map& operator=(const hash_map&) = delete;
+    hash_map(hash_map&&) = delete;
+    hash_map& operator=(hash_map&&) = delete;
+
+    /**
+     * Insert the key or assign the value if it's already present
+     * @returns `false` if there was no bucket left for a new key
+     */
+    bool insert(key_type key, value_type value) noexcept
+    {
+        bucket_s* bucket = claim_bucket(key);
+        if (bucket == nullptr)
+            return false;
+
+        // Key may already be present, so the value is published on its own
+        bucket->value.store(value, std::memory_order_release);
+        bucket->state.store(state_e::PRESENT, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Remove the key
+     * @returns `true` if the key was present
+     */
+    bool erase(key_type key) noexcept
+    {
+        bucket_s* bucket = find_bucket(key);
+        if (bucket == nullptr)
+            return false;
+
+        state_e expected = state_e::PRESENT;
+        return bucket->state.compare_exchange_strong(expected, state_e::ERASED,
+                                                     std::memory_order_acq_rel,
+                                                     std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the value of the key
+     * @returns `true` if the key was found, in which
+     * case the value is copied to the buffer
+     */
+    bool find(key_type key, value_type& value_buffer) const noexcept
+    {
+        const bucket_s* bucket = find_bucket(key);
+        if (bucket == nullptr || bucket->state.load(std::memory_order_acquire) != state_e::PRESENT)
+            return false;
+
+        value_buffer = bucket->value.load(std::memory_order_acquire);
+        return true;
+    }
+
+    /**
+     * Check if the key is present
+     */
+    bool contains(key_type key) const noexcept
+    {
+        const bucket_s* bucket = find_bucket(key);
+        return bucket != nullptr && bucket->state.load(std::memory_order_acquire) == state_e::PRESENT;
+    }
+
+    /**
+     * Get capacity
+     */
+    constexpr size_t get_capacity() const noexcept
+    {
+        return CAPACITY;
+    }
+
+private:
+    /**
+     * Find the bucket holding the key, wait-free since every bucket is checked at most once
+     */
+    const bucket_s* find_bucket(key_type key) const noexcept
+    {
+        if (key == EMPTY_KEY)
+            return nullptr;
+
+        for (size_t i = 0, index = get_hash(key); i < CAPACITY; i++, index = (index + 1) & MASK) {
+            const key_type probed = m_buckets[index].key.load(std::memory_order_acquire);
+            if (probed == key)
+                return &m_buckets[index];
+            // Keys are never removed, so an empty bucket ends the probe sequence
+            if (probed == EMPTY_KEY)
+                return nullptr;
+        }
+        return nullptr;
+    }
+
+    bucket_s* find_bucket(key_type key) noexcept
+    {
+        return const_cast<bucket_s*>(static_cast<const hash_map*>(this)->find_bucket(key));
+    }
+
+    /**
+     * Find the bucket holding the key, or claim the first empty one
+     */
+    bucket_s* claim_bucket(key_type key) noexcept
+    {
+        if (key == EMPTY_KEY)
+            return nullptr;
+
+        for (size_t i = 0, index = get_hash(key); i < CAPACITY; i++, index = (index + 1) & MASK) {
+            key_type probed = m_buckets[index].key.load(std::memory_order_acquire);
+
+            if (probed == EMPTY_KEY) {
+                // If another thread claims the bucket first, the probed key is updated
+                if (m_buckets[index].key.compare_exchange_strong(probed, key,
+                                                                 std::memory_order_acq_rel,
+                                                                 std::memory_order_acquire))
+                    return &m_buckets[index];
+            }
+            if (probed == key)
+                return &m_buckets[index];
+        }
+        return nullptr;
+    }
+
+    /**
+     * Fibonacci hashing, spreads consecutive keys over the whole table
+     */
+    static size_t get_hash(key_type key) noexcept
+    {
+        constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15;
+        return static_cast<size_t>((static_cast<uint64_t>(key) * MULTIPLIER) >> (64 - get_index_bits()));
+    }
+
+    static constexpr size_t get_index_bits() noexcept
+    {
+        size_t bits = 0;
+        while ((size_t(1) << bits) < CAPACITY) {
+            bits++;
+        }
+        return bits;
+    }
+
+private:
+    alignas(CACHE_LINE_SIZE) bucket_s m_buckets[CAPACITY];
+};
+
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include "sequenced_slots.hpp"
+#include <atomic>
+#include <cstddef>
+
+namespace emblib::lockfree {
+
+/**
+ * Lock-free bounded Multi Producer Multi Consumer queue
+ *
+ * @note Each item is delivered to exactly one consumer. Each slot holds a
+ * sequence number which tells whether the slot is free for the producer
+ * claiming that position or holds a published item for the consumer
+ * claiming that position. An index is only claimed with a CAS once the
+ * slot sequence shows it's ready, so producers and consumers don't spin
+ * on the shared indices while waiting for each other. Every push and pop
+ * still does a CAS on the shared tail or head index, the sequences only
+ * remove the contention on the slot data.
+ */
+template <typename item_type, size_t CAPACITY>
+class mpmc_queue {
+    using slots_t = details::sequenced_slots<item_type, CAPACITY>;
+    using slot_s = typename slots_t::slot_s;
+
+public:
+    mpmc_queue() :
+        m_head(0)
+    {}
+
+    mpmc_queue(const mpmc_queue&) = delete;
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+    mpmc_queue(mpmc_queue&&) = delete;
+    mpmc_queue& operator=(mpmc_queue&&) = delete;
+
+    /**
+     * Construct the item in-place in the queue if the queue
+     * is not full.
+     * @note Safe to call from multiple threads
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) noexcept
+    {
+        return m_slots.emplace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Push an item into the queue if the queue is not full.
+     * @note Safe to call from multiple threads
+     */
+    bool push(const item_type& item) noexcept
+    {
+        return emplace(item);
+    }
+
+    /**
+     * Pop
+     * @note Safe to call from multiple threads
+     */
+    bool pop(item_type& item_buffer) noexcept
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        slot_s* slot;
+
+        while (true) {
+            slot = &m_slots.get_slot(head);
+            auto diff = slots_t::get_published_diff(*slot, head);
+
+            if (diff == 0) {
+                // Slot holds the item for this position, try to claim it
+                if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // Item for this position is not published yet, queue is empty
+                return false;
+            } else {
+                // Another consumer claimed this position
+                head = m_head.load(std::memory_order_relaxed);
+            }
+        }
+
+        slots_t::consume(*slot, head, item_buffer);
+        return true;
+    }
+
+    /**
+     * Get capacity
+     */
+    constexpr size_t get_capacity() const noexcept
+    {
+        return CAPACITY;
+    }
+
+private:
+    slots_t m_slots;
+
+    // Shared by all consumers
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head;
+};
+
+}
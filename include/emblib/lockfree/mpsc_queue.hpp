@@ -0,0 +1,86 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include "sequenced_slots.hpp"
+#include <cstddef>
+
+namespace emblib::lockfree {
+
+/**
+ * Lock-free bounded Multi Producer Single Consumer queue
+ *
+ * @note Each slot holds a sequence number which tells whether the slot
+ * is free for the producer claiming that position or holds a published
+ * item for the consumer. Producers only race on the tail index, the
+ * consumer never uses read-modify-write operations.
+ */
+template <typename item_type, size_t CAPACITY>
+class mpsc_queue {
+    using slots_t = details::sequenced_slots<item_type, CAPACITY>;
+    using slot_s = typename slots_t::slot_s;
+
+public:
+    mpsc_queue() :
+        m_head(0)
+    {}
+
+    mpsc_queue(const mpsc_queue&) = delete;
+    mpsc_queue& operator=(const mpsc_queue&) = delete;
+    mpsc_queue(mpsc_queue&&) = delete;
+    mpsc_queue& operator=(mpsc_queue&&) = delete;
+
+    /**
+     * Construct the item in-place in the queue if the queue
+     * is not full.
+     * @note Safe to call from multiple threads
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) noexcept
+    {
+        return m_slots.emplace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Push an item into the queue if the queue is not full.
+     * @note Safe to call from multiple threads
+     */
+    bool push(const item_type& item) noexcept
+    {
+        return emplace(item);
+    }
+
+    /**
+     * Pop
+     * @note Only one thread may consume from the queue
+     */
+    bool pop(item_type& item_buffer) noexcept
+    {
+        size_t head = m_head;
+        slot_s& slot = m_slots.get_slot(head);
+
+        // Item is either not claimed yet or not yet published
+        if (slots_t::get_published_diff(slot, head) != 0) {
+            return false;
+        }
+
+        slots_t::consume(slot, head, item_buffer);
+        m_head = head + 1;
+        return true;
+    }
+
+    /**
+     * Get capacity
+     */
+    constexpr size_t get_capacity() const noexcept
+    {
+        return CAPACITY;
+    }
+
+private:
+    slots_t m_slots;
+
+    // Only accessed by the consumer
+    alignas(CACHE_LINE_SIZE) size_t m_head;
+};
+
+}
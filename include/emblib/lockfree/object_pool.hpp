@@ -0,0 +1,339 @@
+#pragma once
+
+#include "allocator.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace emblib::lockfree {
+
+/**
+ * Pool of objects constructed in blocks of a lock-free `allocator`, handed
+ * out through owning RAII handles
+ *
+ * Handles are not trivially copyable, so to pass an object through one of
+ * the lock-free queues, the handle is released into a raw pointer which is
+ * pushed instead, and adopted by a new handle on the consumer side. This way
+ * only a pointer is copied at each hop, regardless of the object size.
+ */
+template <typename data_type, size_t CAPACITY>
+class object_pool {
+    /**
+     * Object must be the first member, so that pointers to it
+     * can be converted back to the node
+     */
+    struct node_s {
+        data_type value;
+        std::atomic<uint32_t> ref_count;
+    };
+
+public:
+    class shared_handle;
+
+    /**
+     * Handle with exclusive ownership of a pooled object
+     */
+    class unique_handle {
+    public:
+        unique_handle() noexcept :
+            m_pool(nullptr),
+            m_node(nullptr)
+        {}
+
+        unique_handle(const unique_handle&) = delete;
+        unique_handle& operator=(const unique_handle&) = delete;
+
+        unique_handle(unique_handle&& other) noexcept :
+            m_pool(other.m_pool),
+            m_node(std::exchange(other.m_node, nullptr))
+        {}
+
+        unique_handle& operator=(unique_handle&& other) noexcept
+        {
+            if (this != &other) {
+                reset();
+                m_pool = other.m_pool;
+                m_node = std::exchange(other.m_node, nullptr);
+            }
+            return *this;
+        }
+
+        ~unique_handle() noexcept
+        {
+            reset();
+        }
+
+        /**
+         * Destroy the object and return it to the pool
+         */
+        void reset() noexcept
+        {
+            if (m_node != nullptr) {
+                m_pool->destroy(m_node);
+                m_node = nullptr;
+            }
+        }
+
+        /**
+         * Give up the ownership without destroying the object
+         * @note The pointer must be adopted back with `object_pool::adopt_unique`
+         */
+        data_type* release() noexcept
+        {
+            node_s* node = std::exchange(m_node, nullptr);
+            return node != nullptr ? &node->value : nullptr;
+        }
+
+        data_type* get() const noexcept
+        {
+            return m_node != nullptr ? &m_node->value : nullptr;
+        }
+
+        data_type& operator*() const noexcept
+        {
+            return m_node->value;
+        }
+
+        data_type* operator->() const noexcept
+        {
+            return &m_node->value;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return m_node != nullptr;
+        }
+
+    private:
+        friend class object_pool;
+        friend class shared_handle;
+
+        unique_handle(object_pool* pool, node_s* node) noexcept :
+            m_pool(pool),
+            m_node(node)
+        {}
+
+    private:
+        object_pool* m_pool;
+        node_s* m_node;
+    };
+
+    /**
+     * Reference counted handle with shared ownership of a pooled object
+     * @note The object is returned to the pool once the last handle
+     * is destroyed. Reference count is updated atomically, so handles
+     * to the same object can be used from different threads.
+     */
+    class shared_handle {
+    public:
+        shared_handle() noexcept :
+            m_pool(nullptr),
+            m_node(nullptr)
+        {}
+
+        /**
+         * Take over the ownership of a unique handle
+         */
+        shared_handle(unique_handle&& other) noexcept :
+            m_pool(other.m_pool),
+            m_node(std::exchange(other.m_node, nullptr))
+        {
+            if (m_node != nullptr)
+                m_node->ref_count.store(1, std::memory_order_relaxed);
+        }
+
+        shared_handle(const shared_handle& other) noexcept :
+            m_pool(other.m_pool),
+            m_node(other.m_node)
+        {
+            acquire();
+        }
+
+        shared_handle& operator=(const shared_handle& other) noexcept
+        {
+            if (this != &other) {
+                reset();
+                m_pool = other.m_pool;
+                m_node = other.m_node;
+                acquire();
+            }
+            return *this;
+        }
+
+        shared_handle(shared_handle&& other) noexcept :
+            m_pool(other.m_pool),
+            m_node(std::exchange(other.m_node, nullptr))
+        {}
+
+        shared_handle& operator=(shared_handle&& other) noexcept
+        {
+            if (this != &other) {
+                reset();
+                m_pool = other.m_pool;
+                m_node = std::exchange(other.m_node, nullptr);
+            }
+            return *this;
+        }
+
+        ~shared_handle() noexcept
+        {
+            reset();
+        }
+
+        /**
+         * Drop this reference, returning the object to the pool
+         * if it was the last one
+         */
+        void reset() noexcept
+        {
+            if (m_node == nullptr)
+                return;
+
+            if (m_node->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                m_pool->destroy(m_node);
+            m_node = nullptr;
+        }
+
+        /**
+         * Give up this reference without decrementing the reference count
+         * @note The pointer must be adopted back with `object_pool::adopt_shared`
+         */
+        data_type* release() noexcept
+        {
+            node_s* node = std::exchange(m_node, nullptr);
+            return node != nullptr ? &node->value : nullptr;
+        }
+
+        /**
+         * Get the number of handles referencing the object
+         */
+        uint32_t get_use_count() const noexcept
+        {
+            return m_node != nullptr ? m_node->ref_count.load(std::memory_order_relaxed) : 0;
+        }
+
+        data_type* get() const noexcept
+        {
+            return m_node != nullptr ? &m_node->value : nullptr;
+        }
+
+        data_type& operator*() const noexcept
+        {
+            return m_node->value;
+        }
+
+        data_type* operator->() const noexcept
+        {
+            return &m_node->value;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return m_node != nullptr;
+        }
+
+    private:
+        friend class object_pool;
+
+        shared_handle(object_pool* pool, node_s* node) noexcept :
+            m_pool(pool),
+            m_node(node)
+        {}
+
+        void acquire() noexcept
+        {
+            if (m_node != nullptr)
+                m_node->ref_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+    private:
+        object_pool* m_pool;
+        node_s* m_node;
+    };
+
+public:
+    object_pool() = default;
+
+    object_pool(const object_pool&) = delete;
+    object_pool& operator=(const object_pool&) = delete;
+    object_pool(object_pool&&) = delete;
+    object_pool& operator=(object_pool&&) = delete;
+
+    /**
+     * Construct an object in the pool
+     * @returns Handle to the object, empty if the pool is exhausted
+     */
+    template <typename... Args>
+    unique_handle make_unique(Args&&... args) noexcept
+    {
+        return unique_handle(this, create(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Construct an object in the pool with shared ownership
+     * @returns Handle to the object, empty if the pool is exhausted
+     */
+    template <typename... Args>
+    shared_handle make_shared(Args&&... args) noexcept
+    {
+        return shared_handle(make_unique(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Create a unique handle out of a pointer released by a unique handle
+     */
+    unique_handle adopt_unique(data_type* ptr) noexcept
+    {
+        return unique_handle(this, reinterpret_cast<node_s*>(ptr));
+    }
+
+    /**
+     * Create a shared handle out of a pointer released by a shared handle
+     */
+    shared_handle adopt_shared(data_type* ptr) noexcept
+    {
+        return shared_handle(this, reinterpret_cast<node_s*>(ptr));
+    }
+
+    /**
+     * Get the number of objects alive
+     */
+    size_t get_allocation_count() const noexcept
+    {
+        return m_allocator.get_allocation_count();
+    }
+
+    /**
+     * Get capacity
+     */
+    constexpr size_t get_capacity() const noexcept
+    {
+        return CAPACITY;
+    }
+
+private:
+    template <typename... Args>
+    node_s* create(Args&&... args) noexcept
+    {
+        node_s* node = m_allocator.alloc();
+        if (node == nullptr)
+            return nullptr;
+
+        new (&node->value) data_type{std::forward<Args>(args)...};
+        new (&node->ref_count) std::atomic<uint32_t>(1);
+        return node;
+    }
+
+    void destroy(node_s* node) noexcept
+    {
+        node->value.~data_type();
+        m_allocator.dealloc(node);
+    }
+
+private:
+    allocator<node_s, CAPACITY> m_allocator;
+};
+
+}
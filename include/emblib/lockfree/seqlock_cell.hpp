@@ -0,0 +1,120 @@
+#pragma once
+
+#include "backoff.hpp"
+#include "cache_line.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace emblib::lockfree {
+
+/**
+ * Single writer multi reader cell holding the latest value
+ *
+ * The sequence number is odd while the writer updates the value. Readers
+ * copy the value and retry if the sequence changed during the copy, so the
+ * writer is wait-free and readers never block it, no matter how many there are.
+ *
+ * @note Readers retry while a write is in progress, so this fits values which
+ * are small compared to the write interval. Value is copied bytewise, so it
+ * must be trivially copyable; otherwise use `triple_buffer`.
+ */
+template <typename data_type>
+class seqlock_cell {
+    static_assert(std::is_trivially_copyable_v<data_type>);
+
+public:
+    explicit seqlock_cell(const data_type& initial = data_type()) :
+        m_sequence(0),
+        m_value(initial)
+    {}
+
+    seqlock_cell(const seqlock_cell&) = delete;
+    seqlock_cell& operator=(const seqlock_cell&) = delete;
+    seqlock_cell(seqlock_cell&&) = delete;
+    seqlock_cell& operator=(seqlock_cell&&) = delete;
+
+    /**
+     * Publish a new value
+     * @note Only one thread may write to the cell
+     */
+    void write(const data_type& value) noexcept
+    {
+        begin_write();
+        std::memcpy(&m_value, &value, sizeof(data_type));
+        end_write();
+    }
+
+    /**
+     * Start modifying the value in place through `get`,
+     * readers retry until the write ends
+     * @note Only one thread may write to the cell
+     */
+    void begin_write() noexcept
+    {
+        m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    /**
+     * Publish the value modified in place
+     */
+    void end_write() noexcept
+    {
+        m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * Access the value for modification
+     * @note Only between `begin_write` and `end_write`, readers must use `read`
+     */
+    data_type& get() noexcept
+    {
+        return m_value;
+    }
+
+    /**
+     * Get a consistent copy of the latest value
+     * @note Safe to call from multiple threads
+     */
+    data_type read() const noexcept
+    {
+        data_type value;
+        while (!try_read(value)) {
+            cpu_relax();
+        }
+        return value;
+    }
+
+    /**
+     * Try to copy the latest value once
+     * @returns `false` if a write was in progress, in which case the
+     * buffer content is not valid
+     */
+    bool try_read(data_type& buffer) const noexcept
+    {
+        const size_t sequence = m_sequence.load(std::memory_order_acquire);
+        if (sequence & 1)
+            return false;
+
+        std::memcpy(&buffer, &m_value, sizeof(data_type));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return m_sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+    /**
+     * Get the number of values written
+     */
+    size_t get_write_count() const noexcept
+    {
+        return m_sequence.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_sequence;
+    data_type m_value;
+};
+
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace emblib::lockfree {
+
+namespace details {
+
+/**
+ * Ring of slots tagged with sequence numbers, with the producer side
+ * shared by `mpsc_queue` and `mpmc_queue`
+ *
+ * Slot for position `p` is free for the producer claiming it when its
+ * sequence is `p`, holds a published item when it's `p + 1`, and becomes
+ * free for position `p + CAPACITY` once the item is consumed. Producers
+ * still claim positions with a CAS on the shared tail index, the sequences
+ * only keep them from contending on the slot data.
+ *
+ * @note Capacity must be at least 2, since with a single slot a published
+ * item has the same sequence as a slot free for the next position
+ */
+template <typename item_type, size_t CAPACITY>
+class sequenced_slots {
+    static_assert(std::is_trivially_copyable_v<item_type>);
+    static_assert(std::is_trivially_destructible_v<item_type>);
+    static_assert(CAPACITY >= 2, "Published and free slots can't be told apart with a single slot");
+
+public:
+    struct slot_s {
+        std::atomic<size_t> sequence;
+        alignas(item_type) uint8_t data[sizeof(item_type)];
+    };
+
+public:
+    sequenced_slots() noexcept :
+        m_tail(0)
+    {
+        for (size_t i = 0; i < CAPACITY; i++) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    sequenced_slots(const sequenced_slots&) = delete;
+    sequenced_slots& operator=(const sequenced_slots&) = delete;
+    sequenced_slots(sequenced_slots&&) = delete;
+    sequenced_slots& operator=(sequenced_slots&&) = delete;
+
+    /**
+     * Claim the tail position and construct the item in its slot
+     * @returns `false` if the slot still holds an unconsumed item
+     * @note Safe to call from multiple threads
+     */
+    template <typename... Args>
+    bool emplace(Args&&... args) noexcept
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        slot_s* slot;
+
+        while (true) {
+            slot = &get_slot(tail);
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::make_signed_t<size_t>>(sequence - tail);
+
+            if (diff == 0) {
+                // Slot is free for this position, try to claim it
+                if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // Slot still holds the item from the previous loop, queue is full
+                return false;
+            } else {
+                // Another producer claimed this position
+                tail = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (slot->data) item_type{std::forward<Args>(args)...};
+        slot->sequence.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Get the slot of the position
+     */
+    slot_s& get_slot(size_t position) noexcept
+    {
+        return m_slots[position % CAPACITY];
+    }
+
+    /**
+     * Get the difference between the slot sequence and the sequence of an
+     * item published for the position, 0 if the item is ready to be consumed
+     */
+    static std::make_signed_t<size_t> get_published_diff(const slot_s& slot, size_t position) noexcept
+    {
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        return static_cast<std::make_signed_t<size_t>>(sequence - (position + 1));
+    }
+
+    /**
+     * Copy the item published for the claimed position and
+     * free the slot for the producers of the next loop
+     */
+    static void consume(slot_s& slot, size_t position, item_type& item_buffer) noexcept
+    {
+        item_buffer = *reinterpret_cast<const item_type*>(slot.data);
+        slot.sequence.store(position + CAPACITY, std::memory_order_release);
+    }
+
+private:
+    slot_s m_slots[CAPACITY];
+
+    // Shared by all producers
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail;
+};
+
+}
+
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "allocator.hpp"
+#include <etl/span.h>
+#include <etl/tuple.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <new>
+
+namespace emblib::lockfree {
+
+namespace details {
+
+constexpr bool is_strictly_ascending(std::initializer_list<size_t> values) noexcept
+{
+    const size_t* sizes = values.begin();
+    for (size_t i = 1; i < values.size(); i++) {
+        if (sizes[i - 1] >= sizes[i])
+            return false;
+    }
+    return true;
+}
+
+}
+
+/**
+ * Size class of a slab allocator, `BLOCK_COUNT` blocks of `BLOCK_SIZE` bytes
+ */
+template <size_t BLOCK_SIZE, size_t BLOCK_COUNT>
+struct slab_class_s {
+    static constexpr size_t SIZE = BLOCK_SIZE;
+    static constexpr size_t COUNT = BLOCK_COUNT;
+};
+
+/**
+ * Utilisation of a single size class
+ */
+struct slab_usage_s {
+    size_t block_size;
+    size_t capacity;
+    size_t allocated;
+};
+
+/**
+ * Lock-free allocation of variable sized buffers from a fixed set
+ * of size classes, each backed by its own `allocator`
+ *
+ * @note Size classes must be listed in ascending order of block size. A request
+ * is served from the smallest class which fits it, and falls back to larger
+ * classes if that one is exhausted. Blocks are aligned to `std::max_align_t`.
+ */
+template <typename... size_class_types>
+class slab_allocator {
+    static_assert(sizeof...(size_class_types) > 0);
+    static_assert(details::is_strictly_ascending({size_class_types::SIZE...}));
+
+    static constexpr size_t CLASS_COUNT = sizeof...(size_class_types);
+    static constexpr size_t CLASS_SIZES[] = {size_class_types::SIZE...};
+
+    template <size_t SIZE>
+    struct block_s {
+        alignas(std::max_align_t) uint8_t data[SIZE];
+    };
+
+public:
+    slab_allocator() = default;
+
+    slab_allocator(const slab_allocator&) = delete;
+    slab_allocator& operator=(const slab_allocator&) = delete;
+    slab_allocator(slab_allocator&&) = delete;
+    slab_allocator& operator=(slab_allocator&&) = delete;
+
+    /**
+     * Allocate a buffer of at least `size` bytes
+     * @returns Span of `size` bytes if there was a block available in any of the
+     * classes which fit the request, else an empty span
+     * @note Allocated buffer is not initialized
+     */
+    etl::span<uint8_t> alloc(size_t size) noexcept
+    {
+        if (size == 0)
+            return {};
+
+        uint8_t* buffer = alloc_from<0>(size);
+        if (buffer == nullptr)
+            return {};
+
+        return {buffer, size};
+    }
+
+    /**
+     * Deallocate a buffer
+     * @note The provided pointer must originate from the `alloc` method of this
+     * object, otherwise undefined behavior
+     */
+    void dealloc(void* ptr) noexcept
+    {
+        dealloc_from<0>(ptr);
+    }
+
+    /**
+     * Get the number of size classes
+     */
+    static constexpr size_t get_class_count() noexcept
+    {
+        return CLASS_COUNT;
+    }
+
+    /**
+     * Get the utilisation of a size class
+     * @note Classes are indexed in the order of the template parameters
+     */
+    slab_usage_s get_usage(size_t class_index) const noexcept
+    {
+        return get_usage_from<0>(class_index);
+    }
+
+    /**
+     * Get the largest size that can be allocated
+     */
+    static constexpr size_t get_max_size() noexcept
+    {
+        return CLASS_SIZES[CLASS_COUNT - 1];
+    }
+
+private:
+    template <size_t INDEX>
+    uint8_t* alloc_from(size_t size) noexcept
+    {
+        if constexpr (INDEX < CLASS_COUNT) {
+            if (size <= CLASS_SIZES[INDEX]) {
+                auto block = etl::get<INDEX>(m_pools).alloc();
+                if (block != nullptr)
+                    return block->data;
+            }
+            return alloc_from<INDEX + 1>(size);
+        } else {
+            return nullptr;
+        }
+    }
+
+    template <size_t INDEX>
+    void dealloc_from(void* ptr) noexcept
+    {
+        if constexpr (INDEX < CLASS_COUNT) {
+            auto& pool = etl::get<INDEX>(m_pools);
+            if (pool.is_owner_of(ptr)) {
+                using block_t = block_s<CLASS_SIZES[INDEX]>;
+                pool.dealloc(reinterpret_cast<block_t*>(ptr));
+                return;
+            }
+            dealloc_from<INDEX + 1>(ptr);
+        }
+    }
+
+    template <size_t INDEX>
+    slab_usage_s get_usage_from(size_t class_index) const noexcept
+    {
+        if constexpr (INDEX < CLASS_COUNT) {
+            if (class_index == INDEX) {
+                auto& pool = etl::get<INDEX>(m_pools);
+                return {CLASS_SIZES[INDEX], pool.get_capacity(), pool.get_allocation_count()};
+            }
+            return get_usage_from<INDEX + 1>(class_index);
+        } else {
+            return {0, 0, 0};
+        }
+    }
+
+private:
+    etl::tuple<allocator<block_s<size_class_types::SIZE>, size_class_types::COUNT>...> m_pools;
+};
+
+/**
+ * Adapter satisfying the standard Allocator requirements, so that
+ * standard containers can allocate from a slab allocator
+ *
+ * @note If the slab allocator is exhausted, `std::bad_alloc` is thrown
+ * when exceptions are enabled, else the program is aborted.
+ */
+template <typename item_type, typename slab_type>
+class slab_std_allocator {
+    static_assert(alignof(item_type) <= alignof(std::max_align_t));
+
+    template <typename other_item_type, typename other_slab_type>
+    friend class slab_std_allocator;
+
+public:
+    using value_type = item_type;
+
+public:
+    explicit slab_std_allocator(slab_type& slab) noexcept :
+        m_slab(&slab)
+    {}
+
+    template <typename other_item_type>
+    slab_std_allocator(const slab_std_allocator<other_item_type, slab_type>& other) noexcept :
+        m_slab(other.m_slab)
+    {}
+
+    item_type* allocate(size_t count)
+    {
+        auto buffer = m_slab->alloc(count * sizeof(item_type));
+        if (buffer.empty()) {
+#if defined(__cpp_exceptions)
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
+        return reinterpret_cast<item_type*>(buffer.data());
+    }
+
+    void deallocate(item_type* ptr, size_t) noexcept
+    {
+        m_slab->dealloc(ptr);
+    }
+
+    template <typename other_item_type>
+    bool operator==(const slab_std_allocator<other_item_type, slab_type>& other) const noexcept
+    {
+        return m_slab == other.m_slab;
+    }
+
+    template <typename other_item_type>
+    bool operator!=(const slab_std_allocator<other_item_type, slab_type>& other) const noexcept
+    {
+        return m_slab != other.m_slab;
+    }
+
+private:
+    slab_type* m_slab;
+};
+
+}
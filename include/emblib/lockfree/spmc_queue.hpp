@@ -1,19 +1,46 @@
 #pragma once
 
+#include "emblib/metrics/counters.hpp"
 #include <atomic>
-#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 namespace emblib::lockfree {
 
 /**
  * Lock-free Single Producer Multi Consumer queue
+ *
+ * @note Every reader gets every item (broadcast). The producer never waits
+ * for the readers, so a slow reader can be overtaken by the producer. Each
+ * slot holds a sequence number, odd while the slot is being written, which
+ * readers use to validate their copy of the item.
  */
 template <typename item_type, size_t CAPACITY>
 class spmc_queue {
     static_assert(std::is_trivially_copyable_v<item_type>);
     static_assert(std::is_trivially_destructible_v<item_type>);
+    static_assert(CAPACITY > 0);
+
+    struct slot_s {
+        std::atomic<size_t> sequence;
+        alignas(item_type) uint8_t data[sizeof(item_type)];
+    };
+
 public:
+    /**
+     * Indices of the queue metrics, collected if metrics are enabled
+     * @note Read items are counted over all the readers
+     */
+    enum metric_e : size_t {
+        WRITTEN,
+        READ,
+        SKIPPED,
+        METRIC_COUNT
+    };
+
+    static constexpr const char* METRIC_NAMES[METRIC_COUNT] = {"written", "read", "skipped"};
+
     template <bool CHECK_OVERFLOW>
     class reader {
     public:
@@ -37,22 +64,64 @@ public:
         /**
          * Read an item if available.
          * 
-         * @note If `CHECK_OVERFLOW` is false, this function
-         * asserts that no overflow has happened.
+         * @note If `CHECK_OVERFLOW` is true and the producer has overwritten
+         * the next item, the reader skips forward to the oldest item still
+         * in the queue. Otherwise the item is not validated and can be torn
+         * if the producer overtakes the reader.
          */
         bool read(item_type& item_buffer) noexcept
         {
-            if (m_read_ptr == m_queue->m_write_ptr)
-                return false;
+            size_t skip_count;
+            return read(item_buffer, skip_count);
+        }
 
-            if constexpr(CHECK_OVERFLOW) {
-                // We assert because we can't recover
-                assert(!has_overflowed());
+        /**
+         * Read an item if available, and get the number of items which
+         * were skipped because they were overwritten before being read.
+         */
+        bool read(item_type& item_buffer, size_t& skip_count) noexcept
+        {
+            skip_count = 0;
+
+            while (true) {
+                const size_t read_ptr = m_read_ptr.load(std::memory_order_relaxed);
+                const slot_s& slot = m_queue->get_slot(read_ptr);
+                const size_t expected = get_sequence(read_ptr);
+                const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+                // Item at this position isn't completely written yet
+                if (sequence < expected)
+                    return false;
+
+                if constexpr (!CHECK_OVERFLOW) {
+                    std::memcpy(&item_buffer, slot.data, sizeof(item_type));
+                    m_read_ptr.store(read_ptr + 1, std::memory_order_relaxed);
+                    m_queue->m_metrics.add(READ);
+                    return true;
+                }
+
+                if (sequence == expected) {
+                    std::memcpy(&item_buffer, slot.data, sizeof(item_type));
+
+                    // Copy is valid only if the slot wasn't touched in the meantime
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (slot.sequence.load(std::memory_order_relaxed) == expected) {
+                        m_read_ptr.store(read_ptr + 1, std::memory_order_relaxed);
+                        m_queue->m_metrics.add(READ);
+                        return true;
+                    }
+                }
+
+                // Overwritten before or during the copy, resync to the oldest item
+                // and skip at least one item so the reader keeps making progress
+                size_t oldest = m_queue->m_write_ptr.load(std::memory_order_acquire) - CAPACITY;
+                if (oldest <= read_ptr)
+                    oldest = read_ptr + 1;
+
+                skip_count += oldest - read_ptr;
+                m_read_ptr.store(oldest, std::memory_order_relaxed);
+                m_queue->m_metrics.add(SKIPPED, oldest - read_ptr);
             }
-
-            item_buffer = get_item(m_read_ptr % CAPACITY);
-            m_read_ptr++;
-            return true;
         }
 
         /**
@@ -61,15 +130,9 @@ public:
          */
         bool has_overflowed() const noexcept
         {
-            return m_queue->m_alloc_ptr > m_read_ptr + CAPACITY;
-        }
-    
-    private:
-        /**
-         * Get a copy of a queue item.
-         */
-        auto get_item(size_t idx) noexcept {
-            return *reinterpret_cast<const item_type*>(m_queue->m_buffer + idx * sizeof(item_type));
+            const size_t read_ptr = m_read_ptr.load(std::memory_order_relaxed);
+            const slot_s& slot = m_queue->get_slot(read_ptr);
+            return slot.sequence.load(std::memory_order_acquire) > get_sequence(read_ptr);
         }
     
     private:
@@ -79,9 +142,12 @@ public:
 
 public:
     spmc_queue() :
-        m_alloc_ptr(0),
         m_write_ptr(0)
-    {}
+    {
+        for (size_t i = 0; i < CAPACITY; i++) {
+            m_slots[i].sequence.store(0, std::memory_order_relaxed);
+        }
+    }
 
     spmc_queue(const spmc_queue&) = delete;
     spmc_queue& operator=(const spmc_queue&) = delete;
@@ -90,13 +156,23 @@ public:
 
     /**
      * Construct the item in-place in the queue.
+     * @note Wait-free, overwrites the oldest item if the queue is full
      */
     template<typename... Args>
     void emplace(Args&&... args) noexcept
     {
-        m_alloc_ptr++;
-        new (get_slot(m_write_ptr % CAPACITY)) item_type{std::forward<Args>(args)...};
-        m_write_ptr++;
+        const size_t write_ptr = m_write_ptr.load(std::memory_order_relaxed);
+        slot_s& slot = get_slot(write_ptr);
+
+        // Odd sequence marks the slot as being written
+        slot.sequence.store(get_sequence(write_ptr) - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        new (slot.data) item_type{std::forward<Args>(args)...};
+
+        slot.sequence.store(get_sequence(write_ptr), std::memory_order_release);
+        m_write_ptr.store(write_ptr + 1, std::memory_order_release);
+        m_metrics.add(WRITTEN);
     }
 
     /**
@@ -124,16 +200,40 @@ public:
         return m_write_ptr.load();
     }
 
+    /**
+     * Get the metrics, indexed by `metric_e`
+     */
+    const metrics::counters<METRIC_COUNT>& get_metrics() const noexcept
+    {
+        return m_metrics;
+    }
+
 private:
-    item_type* get_slot(size_t idx) noexcept {
-        return reinterpret_cast<item_type*>(m_buffer + idx * sizeof(item_type));
+    slot_s& get_slot(size_t ptr) noexcept
+    {
+        return m_slots[ptr % CAPACITY];
+    }
+
+    const slot_s& get_slot(size_t ptr) const noexcept
+    {
+        return m_slots[ptr % CAPACITY];
+    }
+
+    /**
+     * Sequence of a slot once the item at the given position is written
+     */
+    static constexpr size_t get_sequence(size_t ptr) noexcept
+    {
+        return 2 * ptr + 2;
     }
 
 private:
-    alignas(item_type) uint8_t m_buffer[sizeof(item_type) * CAPACITY];
-    
-    std::atomic<size_t> m_alloc_ptr;
+    slot_s m_slots[CAPACITY];
+
     std::atomic<size_t> m_write_ptr;
+
+    // Updated by the readers through a const queue, empty if metrics are disabled
+    EMBLIB_NO_UNIQUE_ADDRESS mutable metrics::counters<METRIC_COUNT> m_metrics;
 };
 
 }
\ No newline at end of file
@@ -1,28 +1,78 @@
 #pragma once
 
+#include "cache_line.hpp"
+#include "emblib/metrics/counters.hpp"
+#include <etl/span.h>
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 
 namespace emblib::lockfree {
 
+/**
+ * View of a range of ring buffer slots split into two contiguous parts
+ * @note Second part is empty unless the range wraps around the buffer end
+ */
+template <typename item_type>
+struct split_span_s {
+    etl::span<item_type> first;
+    etl::span<item_type> second;
+
+    size_t size() const noexcept
+    {
+        return first.size() + second.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return first.empty();
+    }
+
+    item_type& operator[](size_t idx) const noexcept
+    {
+        return idx < first.size() ? first[idx] : second[idx - first.size()];
+    }
+};
+
 /**
  * Lock-free thread safe Single Producer Single Consumer queue
+ *
+ * @note Producer and consumer indices are kept on separate cache lines,
+ * and each side keeps a local copy of the other side's index which is
+ * only refreshed when the queue seems full (or empty)
  */
 template <typename item_type, size_t CAPACITY>
 class spsc_queue {
     static_assert(std::is_trivially_copyable_v<item_type>);
     static_assert(std::is_trivially_destructible_v<item_type>);
-    
+
     /**
      * Extra slot is used to determine if the queue is full
      * without using a counter
      */
     static constexpr size_t BUFFER_SIZE = CAPACITY + 1;
 
+public:
+    /**
+     * Indices of the queue metrics, collected if metrics are enabled
+     * @note Number of items in the queue is `PUSHED - POPPED`
+     */
+    enum metric_e : size_t {
+        PUSHED,
+        POPPED,
+        FULL,
+        METRIC_COUNT
+    };
+
+    static constexpr const char* METRIC_NAMES[METRIC_COUNT] = {"pushed", "popped", "full"};
+
 public:
     spsc_queue() :
         m_head(0),
-        m_tail(0)
+        m_tail_cache(0),
+        m_tail(0),
+        m_head_cache(0)
     {}
 
     spsc_queue(const spsc_queue&) = delete;
@@ -41,12 +91,17 @@ public:
         size_t next_tail = inc_loop(old_tail);
 
         // If the tail caught up with the head of the queue, it's full
-        if (next_tail == m_head.load(std::memory_order_acquire)) {
-            return false;
+        if (next_tail == m_head_cache) {
+            m_head_cache = m_head.load(std::memory_order_acquire);
+            if (next_tail == m_head_cache) {
+                m_metrics.add(FULL);
+                return false;
+            }
         }
 
         new (get_slot(old_tail)) item_type{std::forward<Args>(args)...};
         m_tail.store(next_tail, std::memory_order_release);
+        m_metrics.add(PUSHED);
         return true;
     }
 
@@ -58,21 +113,151 @@ public:
         return emplace(item);
     }
 
+    /**
+     * Push as many items from the span as there is space for
+     * @returns Number of items pushed, from the start of the span
+     * @note All of the pushed items become visible to the consumer
+     * at the same time
+     */
+    size_t push_n(etl::span<const item_type> items) noexcept
+    {
+        auto slots = reserve(items.size());
+        if (slots.empty()) {
+            return 0;
+        }
+
+        std::copy_n(items.data(), slots.first.size(), slots.first.data());
+        std::copy_n(items.data() + slots.first.size(), slots.second.size(), slots.second.data());
+
+        commit(slots.size());
+        return slots.size();
+    }
+
+    /**
+     * Reserve up to `count` free slots for writing in place
+     * @returns Reserved slots, empty if the queue is full
+     * @note Reserved slots are not initialized and are not visible to the
+     * consumer until they are published with `commit`. Only the producer
+     * may call this method.
+     */
+    split_span_s<item_type> reserve(size_t count = CAPACITY) noexcept
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t free = CAPACITY - get_count(m_head_cache, tail);
+
+        if (free < count) {
+            m_head_cache = m_head.load(std::memory_order_acquire);
+            free = CAPACITY - get_count(m_head_cache, tail);
+        }
+
+        if (free == 0) {
+            m_metrics.add(FULL);
+        }
+
+        // Split in two parts if the range wraps around the buffer end
+        count = std::min(free, count);
+        const size_t first_count = std::min(count, BUFFER_SIZE - tail);
+        return {{get_slot(tail), first_count}, {get_slot(0), count - first_count}};
+    }
+
+    /**
+     * Publish the first `count` slots of the last reservation
+     * @note `count` must not be greater than the size returned
+     * by the last call to `reserve`
+     */
+    void commit(size_t count) noexcept
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        m_tail.store(add_loop(tail, count), std::memory_order_release);
+        m_metrics.add(PUSHED, count);
+    }
+
     /**
      * Pop
      */
     bool pop(item_type& item_buffer) noexcept
     {
         size_t head = m_head.load(std::memory_order_relaxed);
-        if (head == m_tail.load(std::memory_order_acquire)) {
-            return false;
+        if (head == m_tail_cache) {
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+            if (head == m_tail_cache) {
+                return false;
+            }
         }
 
         item_buffer = *get_slot(head);
         m_head.store(inc_loop(head), std::memory_order_release);
+        m_metrics.add(POPPED);
         return true;
     }
 
+    /**
+     * Pop up to the size of the span of items
+     * @returns Number of items written to the start of the span
+     */
+    size_t pop_n(etl::span<item_type> item_buffer) noexcept
+    {
+        auto items = peek(item_buffer.size());
+        if (items.empty()) {
+            return 0;
+        }
+
+        std::copy_n(items.first.data(), items.first.size(), item_buffer.data());
+        std::copy_n(items.second.data(), items.second.size(), item_buffer.data() + items.first.size());
+
+        release(items.size());
+        return items.size();
+    }
+
+    /**
+     * Get up to `count` of the oldest items for reading in place
+     * @returns Items at the front of the queue, empty if the queue is empty
+     * @note Items stay in the queue until they are freed with `release`.
+     * Only the consumer may call this method.
+     */
+    split_span_s<const item_type> peek(size_t count = CAPACITY) noexcept
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        size_t available = get_count(head, m_tail_cache);
+
+        if (available < count) {
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+            available = get_count(head, m_tail_cache);
+        }
+
+        count = std::min(available, count);
+        const size_t first_count = std::min(count, BUFFER_SIZE - head);
+        return {{get_slot(head), first_count}, {get_slot(0), count - first_count}};
+    }
+
+    /**
+     * Remove the first `count` items of the last peek from the queue
+     * @note `count` must not be greater than the size returned
+     * by the last call to `peek`
+     */
+    void release(size_t count) noexcept
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        m_head.store(add_loop(head, count), std::memory_order_release);
+        m_metrics.add(POPPED, count);
+    }
+
+    /**
+     * Get capacity
+     */
+    constexpr size_t get_capacity() const noexcept
+    {
+        return CAPACITY;
+    }
+
+    /**
+     * Get the metrics, indexed by `metric_e`
+     */
+    const metrics::counters<METRIC_COUNT>& get_metrics() const noexcept
+    {
+        return m_metrics;
+    }
+
 private:
     item_type* get_slot(size_t idx) noexcept {
         return reinterpret_cast<item_type*>(m_buffer + idx * sizeof(item_type));
@@ -83,11 +268,34 @@ private:
         return ++idx == BUFFER_SIZE ? 0 : idx;
     }
 
+    static size_t add_loop(size_t idx, size_t count) noexcept
+    {
+        idx += count;
+        return idx >= BUFFER_SIZE ? idx - BUFFER_SIZE : idx;
+    }
+
+    /**
+     * Number of items stored between the given head and tail
+     */
+    static size_t get_count(size_t head, size_t tail) noexcept
+    {
+        return tail >= head ? tail - head : tail + BUFFER_SIZE - head;
+    }
+
 private:
     alignas(item_type) uint8_t m_buffer[sizeof(item_type) * BUFFER_SIZE];
 
-    std::atomic<size_t> m_head;
-    std::atomic<size_t> m_tail;
+    // Consumer owned cache line
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head;
+    size_t m_tail_cache;
+
+    // Producer owned cache line
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail;
+    size_t m_head_cache;
+
+    // Shard is picked per thread, so the producer and consumer usually but not always
+    // update separate cache lines, empty if metrics are disabled
+    EMBLIB_NO_UNIQUE_ADDRESS metrics::counters<METRIC_COUNT> m_metrics;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::lockfree {
+
+/**
+ * Wait-free single writer single reader buffer holding the latest value
+ *
+ * Writer and reader each own one of the three buffers, and the third one
+ * holds the latest published value. Publishing and fetching swap the owned
+ * buffer with the middle one, so neither side ever waits for the other and
+ * the reader never sees a partially written value. Intermediate values are
+ * dropped if the writer is faster than the reader.
+ *
+ * @note Unlike `seqlock_cell`, works with any copy assignable type
+ */
+template <typename data_type>
+class triple_buffer {
+    struct alignas(CACHE_LINE_SIZE) slot_s {
+        data_type value;
+    };
+
+    /**
+     * Flag set in the middle index when it holds a value not yet fetched
+     */
+    static constexpr uint8_t DIRTY = 0x4;
+    static constexpr uint8_t INDEX_MASK = 0x3;
+
+public:
+    explicit triple_buffer(const data_type& initial = data_type()) :
+        m_slots{{initial}, {initial}, {initial}},
+        m_middle(1),
+        m_back(0),
+        m_front(2)
+    {}
+
+    triple_buffer(const triple_buffer&) = delete;
+    triple_buffer& operator=(const triple_buffer&) = delete;
+    triple_buffer(triple_buffer&&) = delete;
+    triple_buffer& operator=(triple_buffer&&) = delete;
+
+    /**
+     * Publish a new value
+     * @note Only the writer may call this method
+     */
+    void write(const data_type& value) noexcept
+    {
+        m_slots[m_back].value = value;
+        publish();
+    }
+
+    /**
+     * Get a reference to the writer owned buffer, to update the value in place
+     * @note Written value is published by calling `publish`
+     */
+    data_type& get_back() noexcept
+    {
+        return m_slots[m_back].value;
+    }
+
+    /**
+     * Publish the writer owned buffer as the latest value
+     */
+    void publish() noexcept
+    {
+        const uint8_t middle = m_middle.exchange(m_back | DIRTY, std::memory_order_acq_rel);
+        m_back = middle & INDEX_MASK;
+    }
+
+    /**
+     * Get the latest published value
+     * @note Only the reader may call this method. Returned reference
+     * is valid until the next call.
+     */
+    const data_type& read() noexcept
+    {
+        if (has_update()) {
+            const uint8_t middle = m_middle.exchange(m_front, std::memory_order_acq_rel);
+            m_front = middle & INDEX_MASK;
+        }
+        return m_slots[m_front].value;
+    }
+
+    /**
+     * Check if a value was published since the last read
+     */
+    bool has_update() const noexcept
+    {
+        return m_middle.load(std::memory_order_relaxed) & DIRTY;
+    }
+
+private:
+    slot_s m_slots[3];
+
+    alignas(CACHE_LINE_SIZE) std::atomic<uint8_t> m_middle;
+    // Writer owned
+    alignas(CACHE_LINE_SIZE) uint8_t m_back;
+    // Reader owned
+    alignas(CACHE_LINE_SIZE) uint8_t m_front;
+};
+
+}
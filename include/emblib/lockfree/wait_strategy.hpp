@@ -0,0 +1,102 @@
+#pragma once
+
+#include "backoff.hpp"
+#include "emblib/io/types.hpp"
+#include <etl/delegate.h>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace emblib::lockfree {
+
+/**
+ * Callback trying to take an item, returns `true` if successful
+ */
+using try_fn_t = etl::delegate<bool()>;
+
+namespace details {
+
+/**
+ * Monotonic deadline of a wait operation
+ */
+class deadline {
+public:
+    explicit deadline(io::timeout timeout) noexcept :
+        m_start(std::chrono::steady_clock::now()),
+        m_timeout(timeout)
+    {}
+
+    /**
+     * Get the time left until the deadline, `io::timeout::max()` if infinite
+     */
+    std::chrono::nanoseconds get_remaining() const noexcept
+    {
+        if (m_timeout == io::timeout::max())
+            return std::chrono::nanoseconds::max();
+
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        const auto timeout = std::chrono::duration_cast<std::chrono::nanoseconds>(m_timeout);
+        return elapsed < timeout ? timeout - elapsed : std::chrono::nanoseconds::zero();
+    }
+
+    bool has_expired() const noexcept
+    {
+        return get_remaining() == std::chrono::nanoseconds::zero();
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+    io::timeout m_timeout;
+};
+
+}
+
+/**
+ * Wait strategy which keeps trying until the timeout,
+ * lowest latency at the cost of a busy core
+ *
+ * Wait strategies provide `wait(try_fn, timeout)` which calls `try_fn`
+ * until it succeeds or the timeout expires, and `notify` which the
+ * producer calls after publishing an item.
+ */
+class spin_wait {
+public:
+    bool wait(try_fn_t try_fn, io::timeout timeout) noexcept
+    {
+        const details::deadline deadline(timeout);
+        while (!try_fn()) {
+            if (deadline.has_expired())
+                return false;
+            cpu_relax();
+        }
+        return true;
+    }
+
+    void notify() noexcept {}
+};
+
+/**
+ * Wait strategy which spins for `SPIN_COUNT` tries,
+ * then yields the core to other threads between tries
+ */
+template <size_t SPIN_COUNT = 100>
+class yield_wait {
+public:
+    bool wait(try_fn_t try_fn, io::timeout timeout) noexcept
+    {
+        const details::deadline deadline(timeout);
+        for (size_t i = 0; !try_fn(); i++) {
+            if (deadline.has_expired())
+                return false;
+            if (i < SPIN_COUNT)
+                cpu_relax();
+            else
+                std::this_thread::yield();
+        }
+        return true;
+    }
+
+    void notify() noexcept {}
+};
+
+}
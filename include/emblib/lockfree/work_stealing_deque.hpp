@@ -0,0 +1,123 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::lockfree {
+
+/**
+ * Bounded Chase-Lev work stealing deque
+ *
+ * The owner thread pushes and pops items at the bottom (LIFO), while any
+ * other thread can steal items from the top (FIFO). Owner operations only
+ * synchronize with thieves when the deque is almost empty.
+ *
+ * @note Items are stored in atomics, so they should be small trivially
+ * copyable types such as pointers or indices
+ */
+template <typename item_type, size_t CAPACITY>
+class work_stealing_deque {
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of 2");
+    static_assert(std::atomic<item_type>::is_always_lock_free);
+
+    static constexpr size_t MASK = CAPACITY - 1;
+
+public:
+    work_stealing_deque() :
+        m_top(0),
+        m_bottom(0)
+    {}
+
+    work_stealing_deque(const work_stealing_deque&) = delete;
+    work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+    work_stealing_deque(work_stealing_deque&&) = delete;
+    work_stealing_deque& operator=(work_stealing_deque&&) = delete;
+
+    /**
+     * Push an item to the bottom if the deque is not full
+     * @note Only the owner thread may call this method
+     */
+    bool push(item_type item) noexcept
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_acquire);
+
+        if (bottom - top >= static_cast<int64_t>(CAPACITY))
+            return false;
+
+        m_items[bottom & MASK].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * Pop the most recently pushed item
+     * @note Only the owner thread may call this method
+     */
+    bool pop(item_type& item_buffer) noexcept
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Deque was empty
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        item_buffer = m_items[bottom & MASK].load(std::memory_order_relaxed);
+        if (top < bottom)
+            return true;
+
+        // Last item, race against the thieves for it
+        const bool won = m_top.compare_exchange_strong(top, top + 1,
+                                                       std::memory_order_seq_cst,
+                                                       std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    /**
+     * Steal the least recently pushed item
+     * @note Safe to call from any thread. Can fail spuriously
+     * if another thread stole the item at the same time.
+     */
+    bool steal(item_type& item_buffer) noexcept
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+            return false;
+
+        item_buffer = m_items[top & MASK].load(std::memory_order_relaxed);
+        return m_top.compare_exchange_strong(top, top + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+    }
+
+    /**
+     * Check if the deque looks empty
+     * @note Result can be stale by the time it's used
+     */
+    bool is_empty() const noexcept
+    {
+        return m_top.load(std::memory_order_relaxed) >= m_bottom.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<item_type> m_items[CAPACITY];
+
+    // Shared between the owner and the thieves
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_top;
+    // Written only by the owner
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_bottom;
+};
+
+}
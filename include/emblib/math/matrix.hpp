@@ -2,6 +2,13 @@
 
 #include "details/matrix_native.hpp"
 
+/**
+ * Backends whose operations can be evaluated at compile time define this as `constexpr`
+ */
+#ifndef EMBLIB_MATRIX_CONSTEXPR
+#define EMBLIB_MATRIX_CONSTEXPR
+#endif
+
 namespace emblib::math {
 
 /**
@@ -46,40 +53,41 @@ public:
      * @note Initial data will depend on the underlying implementation
      * @todo Allow this only if base_type == matrix_native_t
      */
-    matrix() noexcept : m_base() {}
+    EMBLIB_MATRIX_CONSTEXPR matrix() noexcept : m_base() {}
 
     /**
      * Base constructor for creating this wrapper from implementation types
+     * @note Taken by reference, since vectorized Eigen types can't be passed by value on all ABIs
      */
-    explicit matrix(base_type base) noexcept : m_base(base) {}
+    EMBLIB_MATRIX_CONSTEXPR explicit matrix(const base_type& base) noexcept : m_base(base) {}
 
     /**
      * Base constructor for creating this out of another base type
      */
     template <typename other_base>
-    matrix(const matrix_same_t<other_base>& other) noexcept : m_base(other.get_base()) {}
+    EMBLIB_MATRIX_CONSTEXPR matrix(const matrix_same_t<other_base>& other) noexcept : m_base(other.get_base()) {}
 
     /**
      * Base constructor for implicitly casting a bool matrix to this scalar type
      */
     template <typename other_base, typename = std::enable_if<!std::is_same_v<scalar_type, bool>>>
-    matrix(const matrix_similar_t<bool, other_base>& other) noexcept : m_base(other.template cast<scalar_type>().get_base()) {}
+    EMBLIB_MATRIX_CONSTEXPR matrix(const matrix_similar_t<bool, other_base>& other) noexcept : m_base(other.template cast<scalar_type>().get_base()) {}
 
     /**
      * Initialize all the elements of the matrix with the same value
      */
-    matrix(scalar_type scalar) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR matrix(scalar_type scalar) noexcept;
 
     /**
      * Initialize the matrix with the elements
      * @todo Change to fixed size arrays
      */
-    matrix(std::initializer_list<std::initializer_list<scalar_type>> elements) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR matrix(std::initializer_list<std::initializer_list<scalar_type>> elements) noexcept;
 
     /**
      * Get reference to the underlying matrix expression
      */
-    const base_type& get_base() const noexcept
+    EMBLIB_MATRIX_CONSTEXPR const base_type& get_base() const noexcept
     {
         return m_base;
     }
@@ -88,7 +96,7 @@ public:
      * Cast to a different scalar type
      */
     template <typename cast_type>
-    auto cast() const noexcept
+    EMBLIB_MATRIX_CONSTEXPR auto cast() const noexcept
     {
         auto casted_base = cast_base<cast_type>();
         return matrix_similar_t<cast_type, decltype(casted_base)>(casted_base);
@@ -98,7 +106,7 @@ public:
      * Casting operator
      */
     template <typename cast_type>
-    explicit operator cast_type() const noexcept
+    EMBLIB_MATRIX_CONSTEXPR explicit operator cast_type() const noexcept
     {
         return cast<typename cast_type::scalar_t>();
     }
@@ -106,7 +114,7 @@ public:
     /**
      * Get element
      */
-    scalar_type operator()(size_t row, size_t col) const
+    EMBLIB_MATRIX_CONSTEXPR scalar_type operator()(size_t row, size_t col) const
     {
         return m_base(row, col);
     }
@@ -114,7 +122,7 @@ public:
     /**
      * Get element
      */
-    scalar_type& operator()(size_t row, size_t col)
+    EMBLIB_MATRIX_CONSTEXPR scalar_type& operator()(size_t row, size_t col)
     {
         return m_base(row, col);
     }
@@ -124,187 +132,187 @@ public:
      * @todo Create a const version
      */
     template <size_t TOP, size_t LEFT, size_t ROW_COUNT, size_t COL_COUNT>
-    auto get_submatrix() noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto get_submatrix() noexcept;
 
     /**
      * Transpose
      */
-    auto transpose() const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto transpose() const noexcept;
 
     /**
      * Element-wise addition
      */
     template <typename rhs_base>
-    auto operator+(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator+(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise addition with a scalar
      */
-    auto operator+(const scalar_type& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator+(const scalar_type& rhs) const noexcept;
 
     /**
      * Element-wise addition in-place
      */
     template <typename rhs_base>
-    void operator+=(const matrix_same_t<rhs_base>& rhs) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void operator+=(const matrix_same_t<rhs_base>& rhs) noexcept;
 
     /**
      * Element-wise addition in-place with a scalar
      */
-    void operator+=(const scalar_type& rhs) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void operator+=(const scalar_type& rhs) noexcept;
 
     /**
      * Element-wise subtraction
      */
     template <typename rhs_base>
-    auto operator-(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator-(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise subtraction with a scalar
      */
-    auto operator-(const scalar_type& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator-(const scalar_type& rhs) const noexcept;
 
     /**
      * Element-wise subtraction in-place
      */
     template <typename rhs_base>
-    void operator-=(const matrix_same_t<rhs_base>& rhs) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void operator-=(const matrix_same_t<rhs_base>& rhs) noexcept;
 
     /**
      * Element-wise subtraction in-place with a scalar
      */
-    void operator-=(const scalar_type& rhs) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void operator-=(const scalar_type& rhs) noexcept;
 
     /**
      * Element-wise multiplication
      */
     template <typename rhs_scalar, typename rhs_base>
-    auto operator*(const matrix_similar_t<rhs_scalar, rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator*(const matrix_similar_t<rhs_scalar, rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise multiplication with a scalar
      */
     template <typename rhs_scalar>
-    auto operator*(const rhs_scalar& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator*(const rhs_scalar& rhs) const noexcept;
 
     /**
      * Element-wise multiplication in-place
      */
     template <typename rhs_base>
-    void operator*=(const matrix_same_t<rhs_base>& rhs) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void operator*=(const matrix_same_t<rhs_base>& rhs) noexcept;
 
     /**
      * Element-wise in-place multiplication with a scalar
      */
-    void operator*=(const scalar_type& rhs) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void operator*=(const scalar_type& rhs) noexcept;
 
     /**
      * Element-wise division
      */
     template <typename rhs_scalar, typename rhs_base>
-    auto operator/(const matrix_similar_t<rhs_scalar, rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator/(const matrix_similar_t<rhs_scalar, rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise division with a scalar
      */
     template <typename rhs_scalar>
-    auto operator/(const rhs_scalar& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator/(const rhs_scalar& rhs) const noexcept;
 
     /**
      * Element-wise division in-place
      */
     template <typename rhs_base>
-    void operator/=(const matrix_same_t<rhs_base>& rhs) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void operator/=(const matrix_same_t<rhs_base>& rhs) noexcept;
 
     /**
      * Element-wise in-place division with a scalar
      */
-    void operator/=(const scalar_type& rhs) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void operator/=(const scalar_type& rhs) noexcept;
 
     /**
      * Element-wise negative
      */
-    auto operator-() const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator-() const noexcept;
 
     /**
      * Element-wise less than
      */
     template <typename rhs_base>
-    auto operator<(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator<(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise less than or equal to
      */
     template <typename rhs_base>
-    auto operator<=(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator<=(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise less than
      */
     template <typename rhs_base>
-    auto operator>(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator>(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise less than or equal to
      */
     template <typename rhs_base>
-    auto operator>=(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator>=(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise equal
      */
     template <typename rhs_base>
-    auto operator==(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator==(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise logical and
      */
     template <typename rhs_base>
-    auto operator&&(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator&&(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise logical or
      */
     template <typename rhs_base>
-    auto operator||(const matrix_same_t<rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator||(const matrix_same_t<rhs_base>& rhs) const noexcept;
 
     /**
      * Element-wise logical not
      */
-    auto operator!() const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto operator!() const noexcept;
 
     /**
      * Are all elements non-null
      */
-    bool all() const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR bool all() const noexcept;
 
     /**
      * Are any elements non-null
      */
-    bool any() const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR bool any() const noexcept;
 
     /**
      * Fill all elements with the same value
      */
-    void fill(scalar_type scalar) noexcept;
+    EMBLIB_MATRIX_CONSTEXPR void fill(scalar_type scalar) noexcept;
 
     /**
      * Matrix multiplication
      */
     template <size_t RHS_COLS, typename rhs_scalar, typename rhs_base>
-    auto matmul(const matrix<rhs_scalar, COLS, RHS_COLS, rhs_base>& rhs) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto matmul(const matrix<rhs_scalar, COLS, RHS_COLS, rhs_base>& rhs) const noexcept;
 
     /**
      * Equivalent to multiplying this matrix from the left by the inverse of the divisor
      */
     template <typename divisor_base>
-    auto matdivl(const matrix<scalar_type, ROWS, ROWS, divisor_base>& divisor) const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto matdivl(const matrix<scalar_type, ROWS, ROWS, divisor_base>& divisor) const noexcept;
 
     /**
      * Equivalent to multiplying this matrix from the right by the inverse of the divisor
      */
     template <typename divisor_base>
-    auto matdivr(const matrix<scalar_type, COLS, COLS, divisor_base>& divisor) const noexcept
+    EMBLIB_MATRIX_CONSTEXPR auto matdivr(const matrix<scalar_type, COLS, COLS, divisor_base>& divisor) const noexcept
     {
         return matrix<scalar_type, ROWS, COLS>(transpose().matdivl(divisor.transpose()).transpose());
     }
@@ -313,7 +321,7 @@ public:
      * Assign a submatrix
      */
     template <size_t OTHER_ROWS, size_t OTHER_COLS, typename other_base>
-    void set_submatrix(
+    EMBLIB_MATRIX_CONSTEXPR void set_submatrix(
         size_t row_begin,
         size_t col_begin,
         const matrix<scalar_type, OTHER_ROWS, OTHER_COLS, other_base>& other
@@ -331,7 +339,7 @@ public:
     /**
      * Diagonal matrix
      */
-    static matrix diagonal(scalar_type diag_elem = 1) noexcept
+    static EMBLIB_MATRIX_CONSTEXPR matrix diagonal(scalar_type diag_elem = 1) noexcept
     {
         static_assert(ROWS == COLS);
         matrix result(0);
@@ -342,7 +350,7 @@ public:
 
 private:
     template <typename cast_type>
-    auto cast_base() const noexcept;
+    EMBLIB_MATRIX_CONSTEXPR auto cast_base() const noexcept;
 
 private:
     base_type m_base;
@@ -354,7 +362,7 @@ private:
  * External operator for multiplying a scalar by a matrix
  */
 template <typename scalar_type, size_t ROWS, size_t COLS, typename matrix_base>
-auto operator*(const scalar_type& lhs, const matrix<scalar_type, ROWS, COLS, matrix_base>& rhs) noexcept
+EMBLIB_MATRIX_CONSTEXPR auto operator*(const scalar_type& lhs, const matrix<scalar_type, ROWS, COLS, matrix_base>& rhs) noexcept
 {
     return rhs * lhs;
 }
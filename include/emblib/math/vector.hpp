@@ -19,30 +19,30 @@ public:
     template <typename other_base>
     using vector_same_t = vector<scalar_type, DIM, other_base>;
 
-    vector() :
+    EMBLIB_MATRIX_CONSTEXPR vector() :
         matrix<scalar_type, DIM, 1, base_type>() {}
 
-    explicit vector(base_type base) :
+    EMBLIB_MATRIX_CONSTEXPR explicit vector(const base_type& base) :
         matrix<scalar_type, DIM, 1, base_type>(base) {}
 
-    vector(scalar_type scalar) :
+    EMBLIB_MATRIX_CONSTEXPR vector(scalar_type scalar) :
         matrix<scalar_type, DIM, 1, base_type>(scalar) {}
 
-    vector(std::initializer_list<scalar_type> elements) :
+    EMBLIB_MATRIX_CONSTEXPR vector(std::initializer_list<scalar_type> elements) :
         matrix<scalar_type, DIM, 1, base_type>({elements}) {}
 
     template <typename other_base>
-    vector(const matrix<scalar_type, DIM, 1, other_base>& matrix) :
+    EMBLIB_MATRIX_CONSTEXPR vector(const matrix<scalar_type, DIM, 1, other_base>& matrix) :
         matrix<scalar_type, DIM, 1, base_type>(matrix) {}
 
     template <typename other_base, typename = std::enable_if<!std::is_same_v<scalar_type, bool>>>
-    vector(const matrix<bool, DIM, 1, other_base>& matrix) :
+    EMBLIB_MATRIX_CONSTEXPR vector(const matrix<bool, DIM, 1, other_base>& matrix) :
         matrix<scalar_type, DIM, 1, base_type>(matrix.template cast<scalar_type>()) {}
 
     /**
      * Get element as a copy
      */
-    scalar_type operator()(size_t idx) const
+    EMBLIB_MATRIX_CONSTEXPR scalar_type operator()(size_t idx) const
     {
         return matrix<scalar_type, DIM, 1, base_type>::operator()(idx, 0);
     }
@@ -50,7 +50,7 @@ public:
     /**
      * Get element by reference
      */
-    scalar_type& operator()(size_t idx)
+    EMBLIB_MATRIX_CONSTEXPR scalar_type& operator()(size_t idx)
     {
         return matrix<scalar_type, DIM, 1, base_type>::operator()(idx, 0);
     }
@@ -59,7 +59,7 @@ public:
      * Dot product
      */
     template <typename rhs_base>
-    scalar_type dot(const vector_same_t<rhs_base>& rhs) const noexcept
+    EMBLIB_MATRIX_CONSTEXPR scalar_type dot(const vector_same_t<rhs_base>& rhs) const noexcept
     {
         const auto res = this->transpose().matmul(rhs);
         return res(0, 0);
@@ -69,7 +69,7 @@ public:
      * Cross product
      */
     template <typename rhs_base>
-    vector cross(const vector_same_t<rhs_base>& rhs) const noexcept
+    EMBLIB_MATRIX_CONSTEXPR vector cross(const vector_same_t<rhs_base>& rhs) const noexcept
     {
         static_assert(DIM == 3);
         auto lhs = *this;
@@ -83,7 +83,7 @@ public:
     /**
      * Compute the square of the norm
      */
-    scalar_type norm_sq() const noexcept
+    EMBLIB_MATRIX_CONSTEXPR scalar_type norm_sq() const noexcept
     {
         scalar_type res {0};
         for (size_t i = 0; i < DIM; i++) {
@@ -114,7 +114,7 @@ public:
      * Create a square matrix with elements of this vector
      * as diagonal elements
      */
-    matrix<scalar_type, DIM> as_diagonal() const noexcept
+    EMBLIB_MATRIX_CONSTEXPR matrix<scalar_type, DIM> as_diagonal() const noexcept
     {
         matrix<scalar_type, DIM> result {0};
         for (size_t i = 0; i < DIM; i++) {
@@ -129,7 +129,7 @@ public:
  * a vector as a scalar when multiplying a matrix
  */
 template <typename lhs_scalar, typename rhs_scalar, size_t DIM, typename lhs_base, typename rhs_base>
-auto operator*(const matrix<lhs_scalar, DIM, 1, lhs_base>& lhs, const vector<rhs_scalar, DIM, rhs_base>& rhs) noexcept
+EMBLIB_MATRIX_CONSTEXPR auto operator*(const matrix<lhs_scalar, DIM, 1, lhs_base>& lhs, const vector<rhs_scalar, DIM, rhs_base>& rhs) noexcept
 {
     return lhs * static_cast<const matrix<rhs_scalar, DIM, 1, rhs_base>&>(rhs);
 }
@@ -139,7 +139,7 @@ auto operator*(const matrix<lhs_scalar, DIM, 1, lhs_base>& lhs, const vector<rhs
  * a vector as a scalar when dividing a matrix
  */
 template <typename lhs_scalar, typename rhs_scalar, size_t DIM, typename lhs_base, typename rhs_base>
-auto operator/(const matrix<lhs_scalar, DIM, 1, lhs_base>& lhs, const vector<rhs_scalar, DIM, rhs_base>& rhs) noexcept
+EMBLIB_MATRIX_CONSTEXPR auto operator/(const matrix<lhs_scalar, DIM, 1, lhs_base>& lhs, const vector<rhs_scalar, DIM, rhs_base>& rhs) noexcept
 {
     return lhs / static_cast<const matrix<rhs_scalar, DIM, 1, rhs_base>&>(rhs);
 }
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "emblib/lockfree/cache_line.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Marks members of empty metric types so they take no space. The attribute
+ * is only standard since C++20, GCC and Clang honor it in C++17 as well,
+ * MSVC ignores it and needs its own, and elsewhere the member takes a byte.
+ */
+#if defined(_MSC_VER)
+#define EMBLIB_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define EMBLIB_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+namespace emblib::metrics {
+
+/**
+ * Metrics of the library types are only collected if `EMBLIB_METRICS`
+ * is defined, otherwise they compile to empty types
+ */
+#ifdef EMBLIB_METRICS
+constexpr bool IS_ENABLED = true;
+#else
+constexpr bool IS_ENABLED = false;
+#endif
+
+/**
+ * Number of shards of each counter group
+ * @note Can be overridden by defining `EMBLIB_METRICS_SHARD_COUNT`
+ */
+#ifdef EMBLIB_METRICS_SHARD_COUNT
+constexpr size_t SHARD_COUNT = EMBLIB_METRICS_SHARD_COUNT;
+#else
+constexpr size_t SHARD_COUNT = 8;
+#endif
+
+namespace details {
+
+/**
+ * Get the shard used by the calling thread, threads are assigned
+ * shards in round robin order on their first update
+ */
+inline size_t get_shard_index() noexcept
+{
+    static std::atomic<size_t> s_next_index(0);
+    static thread_local const size_t s_index = s_next_index.fetch_add(1, std::memory_order_relaxed);
+    return s_index;
+}
+
+}
+
+/**
+ * Group of counters updated from multiple threads
+ *
+ * Each thread updates the counters in its own cache line, so updates on hot
+ * paths don't bounce cache lines between cores. Reading sums all the shards.
+ * Values are signed, so a counter can also be used as a gauge which is
+ * incremented and decremented, for example the number of items in use.
+ *
+ * @note Sum is not an atomic snapshot of all shards, but every
+ * update is included once it's visible to the reading thread
+ */
+template <size_t COUNT, size_t SHARDS = SHARD_COUNT>
+class sharded_counters {
+    static_assert(COUNT > 0 && SHARDS > 0);
+
+    struct alignas(lockfree::CACHE_LINE_SIZE) shard_s {
+        std::atomic<int64_t> values[COUNT];
+    };
+
+public:
+    sharded_counters() noexcept :
+        m_shards{}
+    {}
+
+    sharded_counters(const sharded_counters&) = delete;
+    sharded_counters& operator=(const sharded_counters&) = delete;
+    sharded_counters(sharded_counters&&) = delete;
+    sharded_counters& operator=(sharded_counters&&) = delete;
+
+    /**
+     * Add to the counter at the index
+     */
+    void add(size_t index, int64_t value = 1) noexcept
+    {
+        m_shards[details::get_shard_index() % SHARDS].values[index].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * Subtract from the counter at the index
+     */
+    void sub(size_t index, int64_t value = 1) noexcept
+    {
+        add(index, -value);
+    }
+
+    /**
+     * Get the sum of the counter at the index over all shards
+     */
+    int64_t get(size_t index) const noexcept
+    {
+        int64_t sum = 0;
+        for (const auto& shard : m_shards) {
+            sum += shard.values[index].load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    /**
+     * Get the number of counters in the group
+     */
+    static constexpr size_t get_count() noexcept
+    {
+        return COUNT;
+    }
+
+private:
+    shard_s m_shards[SHARDS];
+};
+
+/**
+ * Counter group with the same interface as `sharded_counters`
+ * which doesn't count anything
+ */
+template <size_t COUNT>
+class null_counters {
+public:
+    void add(size_t, int64_t = 1) noexcept {}
+    void sub(size_t, int64_t = 1) noexcept {}
+    int64_t get(size_t) const noexcept { return 0; }
+
+    static constexpr size_t get_count() noexcept
+    {
+        return COUNT;
+    }
+};
+
+/**
+ * Counter group embedded in library types, empty if metrics are disabled
+ * @note Members of this type should be marked `EMBLIB_NO_UNIQUE_ADDRESS`
+ */
+template <size_t COUNT>
+using counters = std::conditional_t<IS_ENABLED, sharded_counters<COUNT>, null_counters<COUNT>>;
+
+/**
+ * Value set by a single writer, such as the current depth of a queue,
+ * which also tracks the maximum value set
+ */
+class gauge {
+public:
+    gauge() noexcept :
+        m_value(0),
+        m_max(0)
+    {}
+
+    gauge(const gauge&) = delete;
+    gauge& operator=(const gauge&) = delete;
+    gauge(gauge&&) = delete;
+    gauge& operator=(gauge&&) = delete;
+
+    /**
+     * Set the current value
+     */
+    void set(int64_t value) noexcept
+    {
+        m_value.store(value, std::memory_order_relaxed);
+        if (value > m_max.load(std::memory_order_relaxed)) {
+            m_max.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Get the last value set
+     */
+    int64_t get() const noexcept
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the largest value set
+     */
+    int64_t get_max() const noexcept
+    {
+        return m_max.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> m_value;
+    std::atomic<int64_t> m_max;
+};
+
+}
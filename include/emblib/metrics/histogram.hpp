@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::metrics {
+
+/**
+ * Histogram of unsigned values with power of 2 buckets
+ *
+ * Bucket 0 counts zeros and bucket `i` counts values in [2^(i-1), 2^i),
+ * while the last bucket also counts all larger values. Recording is a single
+ * relaxed increment plus a compare of the maximum, lock-free from any number
+ * of threads. Percentiles are reported as the upper bound of their bucket,
+ * so they are within a factor of 2 of the exact value.
+ *
+ * @note Buckets are read one by one, so a histogram read while being
+ * updated may not include the most recent values in all of its results
+ */
+template <size_t BUCKET_COUNT = 48>
+class histogram {
+    static_assert(BUCKET_COUNT >= 2 && BUCKET_COUNT <= 65);
+
+public:
+    histogram() noexcept :
+        m_buckets{},
+        m_max(0)
+    {}
+
+    histogram(const histogram&) = delete;
+    histogram& operator=(const histogram&) = delete;
+    histogram(histogram&&) = delete;
+    histogram& operator=(histogram&&) = delete;
+
+    /**
+     * Count the value in its bucket
+     */
+    void record(uint64_t value) noexcept
+    {
+        m_buckets[get_bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t max = m_max.load(std::memory_order_relaxed);
+        while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+    }
+
+    /**
+     * Get the number of values counted in the bucket
+     */
+    uint64_t get_bucket(size_t index) const noexcept
+    {
+        return m_buckets[index].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the number of recorded values
+     */
+    uint64_t get_count() const noexcept
+    {
+        uint64_t count = 0;
+        for (const auto& bucket : m_buckets) {
+            count += bucket.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    /**
+     * Get the largest recorded value
+     */
+    uint64_t get_max() const noexcept
+    {
+        return m_max.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the value below which the fraction `p` of the recorded values fall
+     * @returns Upper bound of the bucket holding the percentile,
+     * limited to the maximum, or 0 if nothing was recorded
+     */
+    uint64_t get_percentile(double p) const noexcept
+    {
+        const uint64_t count = get_count();
+        if (count == 0)
+            return 0;
+
+        // Nearest rank of the value, counted from 1
+        const double exact_rank = p * static_cast<double>(count);
+        uint64_t rank = static_cast<uint64_t>(exact_rank);
+        if (rank < exact_rank || rank == 0)
+            rank++;
+        uint64_t total = 0;
+
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            total += get_bucket(i);
+            if (total >= rank && i + 1 < BUCKET_COUNT) {
+                const uint64_t upper = i == 0 ? 0 : (uint64_t(2) << (i - 1)) - 1;
+                return upper < get_max() ? upper : get_max();
+            }
+        }
+        return get_max();
+    }
+
+    /**
+     * Get the number of buckets
+     */
+    static constexpr size_t get_bucket_count() noexcept
+    {
+        return BUCKET_COUNT;
+    }
+
+    /**
+     * Get the index of the bucket counting the value
+     */
+    static constexpr size_t get_bucket_index(uint64_t value) noexcept
+    {
+        size_t bits = 0;
+        for (; value != 0; value >>= 1) {
+            bits++;
+        }
+        return bits < BUCKET_COUNT ? bits : BUCKET_COUNT - 1;
+    }
+
+private:
+    std::atomic<uint64_t> m_buckets[BUCKET_COUNT];
+    std::atomic<uint64_t> m_max;
+};
+
+/**
+ * Histogram used when profiling is disabled, all the methods do nothing
+ */
+template <size_t BUCKET_COUNT = 48>
+class null_histogram {
+public:
+    void record(uint64_t) noexcept {}
+    uint64_t get_bucket(size_t) const noexcept { return 0; }
+    uint64_t get_count() const noexcept { return 0; }
+    uint64_t get_max() const noexcept { return 0; }
+    uint64_t get_percentile(double) const noexcept { return 0; }
+
+    static constexpr size_t get_bucket_count() noexcept
+    {
+        return BUCKET_COUNT;
+    }
+};
+
+}
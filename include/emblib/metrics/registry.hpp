@@ -0,0 +1,279 @@
+#pragma once
+
+#include "counters.hpp"
+#include "histogram.hpp"
+#include "emblib/lockfree/backoff.hpp"
+#include <etl/span.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::metrics {
+
+/**
+ * Maximum number of metric sources registered at the same time
+ * @note Can be overridden by defining `EMBLIB_METRICS_REGISTRY_SIZE`
+ */
+#ifdef EMBLIB_METRICS_REGISTRY_SIZE
+constexpr size_t REGISTRY_SIZE = EMBLIB_METRICS_REGISTRY_SIZE;
+#else
+constexpr size_t REGISTRY_SIZE = 32;
+#endif
+
+/**
+ * Single value read from a registered metric source
+ */
+struct sample_s {
+    const char* name;
+    const char* value_name;
+    int64_t value;
+};
+
+/**
+ * Global registry of named metric sources
+ *
+ * Sources are registered in a fixed table, and `snapshot` reads all of them
+ * without blocking the threads updating the metrics or registering sources.
+ * Each table entry is guarded by a sequence number, so an entry replaced
+ * while the snapshot copies it is skipped, and removing a source waits
+ * until no snapshot is reading it.
+ *
+ * @note Source must not be destroyed before its registration
+ */
+class registry {
+    /**
+     * Entry sequence modulo 4, entry is free again after removal
+     */
+    static constexpr uint32_t FREE = 0;
+    static constexpr uint32_t WRITING = 1;
+    static constexpr uint32_t READY = 2;
+
+    struct entry_s {
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint32_t> readers;
+        const char* name;
+        const char* const* value_names;
+        size_t count;
+        const void* source;
+        int64_t (*read_fn)(const void* source, size_t index);
+    };
+
+public:
+    /**
+     * Keeps the source registered while in scope
+     */
+    class registration {
+    public:
+        registration() noexcept = default;
+
+        ~registration() noexcept
+        {
+            reset();
+        }
+
+        registration(const registration&) = delete;
+        registration& operator=(const registration&) = delete;
+
+        registration(registration&& other) noexcept :
+            m_entry(other.m_entry)
+        {
+            other.m_entry = nullptr;
+        }
+
+        registration& operator=(registration&& other) noexcept
+        {
+            if (this != &other) {
+                reset();
+                m_entry = other.m_entry;
+                other.m_entry = nullptr;
+            }
+            return *this;
+        }
+
+        /**
+         * Check if the source was registered
+         * @note Fails if the registry is full or metrics are disabled
+         */
+        bool is_valid() const noexcept
+        {
+            return m_entry != nullptr;
+        }
+
+        /**
+         * Remove the source from the registry
+         * @note Waits for the snapshots reading the source to finish
+         */
+        void reset() noexcept
+        {
+            if (m_entry == nullptr)
+                return;
+
+            const uint32_t sequence = m_entry->sequence.load(std::memory_order_relaxed);
+            m_entry->sequence.store(sequence + 2, std::memory_order_seq_cst);
+
+            // Snapshots which started after this see a free entry
+            while (m_entry->readers.load(std::memory_order_seq_cst) != 0)
+                lockfree::cpu_relax();
+            m_entry = nullptr;
+        }
+
+    private:
+        friend class registry;
+
+        explicit registration(entry_s* entry) noexcept :
+            m_entry(entry)
+        {}
+
+        entry_s* m_entry = nullptr;
+    };
+
+public:
+    registry() = delete;
+
+    /**
+     * Register a group of counters, with a name for each of the counters
+     */
+    template <size_t COUNT, size_t SHARDS>
+    static registration add(const char* name,
+                            const sharded_counters<COUNT, SHARDS>& counters,
+                            const char* const (&value_names)[COUNT]) noexcept
+    {
+        auto read_fn = [](const void* source, size_t index) {
+            return static_cast<const sharded_counters<COUNT, SHARDS>*>(source)->get(index);
+        };
+        return add(name, &counters, value_names, COUNT, read_fn);
+    }
+
+    /**
+     * Counters of disabled metrics are not registered
+     */
+    template <size_t COUNT>
+    static registration add(const char*, const null_counters<COUNT>&, const char* const (&)[COUNT]) noexcept
+    {
+        return {};
+    }
+
+    /**
+     * Register a gauge, sampled as its current and maximum value
+     */
+    static registration add(const char* name, const gauge& gauge) noexcept
+    {
+        static constexpr const char* VALUE_NAMES[] = {"value", "max"};
+        auto read_fn = [](const void* source, size_t index) {
+            auto gauge = static_cast<const metrics::gauge*>(source);
+            return index == 0 ? gauge->get() : gauge->get_max();
+        };
+        return add(name, &gauge, VALUE_NAMES, 2, read_fn);
+    }
+
+    /**
+     * Register a histogram, sampled as its count, median, 99th percentile and maximum
+     */
+    template <size_t BUCKET_COUNT>
+    static registration add(const char* name, const histogram<BUCKET_COUNT>& histogram) noexcept
+    {
+        static constexpr const char* VALUE_NAMES[] = {"count", "p50", "p99", "max"};
+        auto read_fn = [](const void* source, size_t index) {
+            auto histogram = static_cast<const metrics::histogram<BUCKET_COUNT>*>(source);
+            switch (index) {
+            case 0: return static_cast<int64_t>(histogram->get_count());
+            case 1: return static_cast<int64_t>(histogram->get_percentile(0.5));
+            case 2: return static_cast<int64_t>(histogram->get_percentile(0.99));
+            default: return static_cast<int64_t>(histogram->get_max());
+            }
+        };
+        return add(name, &histogram, VALUE_NAMES, 4, read_fn);
+    }
+
+    /**
+     * Histograms of disabled profiling are not registered
+     */
+    template <size_t BUCKET_COUNT>
+    static registration add(const char*, const null_histogram<BUCKET_COUNT>&) noexcept
+    {
+        return {};
+    }
+
+    /**
+     * Register the metrics of a library type which provides
+     * `get_metrics()` and `METRIC_NAMES`
+     */
+    template <typename source_type>
+    static registration add(const char* name, const source_type& source) noexcept
+    {
+        return add(name, source.get_metrics(), source_type::METRIC_NAMES);
+    }
+
+    /**
+     * Read all the registered values
+     * @returns Number of samples written to the start of the span. Samples
+     * which don't fit in the span are skipped.
+     */
+    static size_t snapshot(etl::span<sample_s> samples) noexcept
+    {
+        size_t count = 0;
+
+        for (auto& entry : s_entries) {
+            // Registration can't be removed while the entry is being read
+            entry.readers.fetch_add(1, std::memory_order_seq_cst);
+            count += read_entry(entry, samples, count);
+            entry.readers.fetch_sub(1, std::memory_order_release);
+        }
+        return count;
+    }
+
+private:
+    /**
+     * Write the samples of a registered entry after the first `offset` samples
+     * @returns Number of samples written
+     */
+    static size_t read_entry(const entry_s& entry, etl::span<sample_s> samples, size_t offset) noexcept
+    {
+        const uint32_t sequence = entry.sequence.load(std::memory_order_seq_cst);
+        if (sequence % 4 != READY)
+            return 0;
+
+        // Fields are rewritten if the entry is removed and added again in the meantime
+        const char* name = entry.name;
+        const char* const* value_names = entry.value_names;
+        const size_t count = entry.count;
+        const void* source = entry.source;
+        const auto read_fn = entry.read_fn;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry.sequence.load(std::memory_order_relaxed) != sequence || offset + count > samples.size())
+            return 0;
+
+        for (size_t i = 0; i < count; i++) {
+            samples[offset + i] = {name, value_names[i], read_fn(source, i)};
+        }
+        return count;
+    }
+
+    static registration add(const char* name, const void* source, const char* const* value_names,
+                            size_t count, int64_t (*read_fn)(const void*, size_t)) noexcept
+    {
+        for (auto& entry : s_entries) {
+            uint32_t sequence = entry.sequence.load(std::memory_order_relaxed);
+            if (sequence % 4 != FREE)
+                continue;
+            if (!entry.sequence.compare_exchange_strong(sequence, sequence + WRITING, std::memory_order_acquire))
+                continue;
+
+            entry.name = name;
+            entry.value_names = value_names;
+            entry.count = count;
+            entry.source = source;
+            entry.read_fn = read_fn;
+
+            entry.sequence.store(sequence + READY, std::memory_order_release);
+            return registration(&entry);
+        }
+        return {};
+    }
+
+private:
+    static inline entry_s s_entries[REGISTRY_SIZE] = {};
+};
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+
+namespace emblib::rtos {
+
+/**
+ * Monotonic clock which can put the calling thread to sleep
+ * until an absolute point in time
+ *
+ * Time is measured from an arbitrary epoch. Sleeping until absolute
+ * times, instead of for relative durations, keeps periodic work from
+ * drifting when the work itself or a wake up takes longer than expected.
+ */
+class clock {
+public:
+    virtual ~clock() = default;
+
+    /**
+     * Get the current time
+     */
+    virtual std::chrono::nanoseconds now() const noexcept = 0;
+
+    /**
+     * Sleep until the time is reached, returns immediately if it's in the past
+     */
+    virtual void sleep_until(std::chrono::nanoseconds time) noexcept = 0;
+};
+
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "clock.hpp"
+#include "emblib/metrics/counters.hpp"
+#include <etl/delegate.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::rtos {
+
+/**
+ * Executive releasing periodic tasks at fixed rates on a single thread
+ *
+ * Every task is released at multiples of its period from the start of
+ * `run`, with the deadline at its next release. Whenever tasks are ready,
+ * the one with the highest priority runs to completion, and ties are broken
+ * in rate-monotonic order where the shorter period wins. Between releases
+ * the thread sleeps until the next one using absolute time, so the schedule
+ * doesn't drift.
+ *
+ * Each task records its execution time, its release jitter (delay of the
+ * start after the release) and the number of missed deadlines. A job which
+ * finishes later than its deadline is a miss, and releases which were
+ * skipped entirely because the task fell more than a period behind are
+ * counted as misses too. Statistics are atomic, so they can be read from
+ * any thread while the executive runs.
+ *
+ * @note Tasks are not preempted, so a long task delays all the others.
+ * For preemption run an executive per priority level on threads with
+ * the matching `thread_config_s::priority`.
+ */
+template <size_t TASK_CAPACITY>
+class cyclic_executive {
+public:
+    /**
+     * Periodic task callback
+     */
+    using task_fn_t = etl::delegate<void()>;
+
+    /**
+     * Index returned if a task couldn't be added
+     */
+    static constexpr size_t NO_TASK = TASK_CAPACITY;
+
+    /**
+     * Statistics of a task
+     */
+    class task_stats {
+    public:
+        enum metric_e : size_t {
+            RUNS,
+            DEADLINE_MISSES,
+            METRIC_COUNT
+        };
+
+        static constexpr const char* METRIC_NAMES[METRIC_COUNT] = {"runs", "deadline_misses"};
+
+    public:
+        /**
+         * Get the run and miss counts, indexed by `metric_e`
+         */
+        const metrics::sharded_counters<METRIC_COUNT, 1>& get_metrics() const noexcept
+        {
+            return m_counters;
+        }
+
+        /**
+         * Get the execution time of the last and the longest job, in nanoseconds
+         */
+        const metrics::gauge& get_execution_time() const noexcept
+        {
+            return m_execution_time;
+        }
+
+        /**
+         * Get the release jitter of the last and the worst job, in nanoseconds
+         */
+        const metrics::gauge& get_jitter() const noexcept
+        {
+            return m_jitter;
+        }
+
+    private:
+        friend class cyclic_executive;
+
+        // Single shard, all the updates are made by the executive thread
+        metrics::sharded_counters<METRIC_COUNT, 1> m_counters;
+        metrics::gauge m_execution_time;
+        metrics::gauge m_jitter;
+    };
+
+private:
+    struct task_s {
+        task_fn_t fn;
+        std::chrono::nanoseconds period;
+        std::chrono::nanoseconds release;
+        int priority;
+        task_stats stats;
+    };
+
+public:
+    explicit cyclic_executive(rtos::clock& clock) noexcept :
+        m_clock(clock),
+        m_task_count(0),
+        m_running(false)
+    {}
+
+    cyclic_executive(const cyclic_executive&) = delete;
+    cyclic_executive& operator=(const cyclic_executive&) = delete;
+    cyclic_executive(cyclic_executive&&) = delete;
+    cyclic_executive& operator=(cyclic_executive&&) = delete;
+
+    /**
+     * Add a task released every `period`
+     * @param priority Higher runs first, tasks with equal
+     * priority run in rate-monotonic order
+     * @returns Index of the task used to read its statistics,
+     * or `NO_TASK` if there is no space or the period is not positive
+     * @note Tasks must be added before `run` is called
+     */
+    size_t add_task(task_fn_t fn, std::chrono::nanoseconds period, int priority = 0) noexcept
+    {
+        if (m_task_count == TASK_CAPACITY || period <= std::chrono::nanoseconds::zero())
+            return NO_TASK;
+
+        task_s& task = m_tasks[m_task_count];
+        task.fn = fn;
+        task.period = period;
+        task.priority = priority;
+
+        // Keep the schedule sorted from the most urgent task
+        m_order[m_task_count] = m_task_count;
+        std::stable_sort(m_order, m_order + m_task_count + 1, [this](size_t lhs, size_t rhs) {
+            const task_s& a = m_tasks[lhs];
+            const task_s& b = m_tasks[rhs];
+            return a.priority != b.priority ? a.priority > b.priority : a.period < b.period;
+        });
+        return m_task_count++;
+    }
+
+    /**
+     * Release the tasks on the calling thread until `stop` is called
+     * @note All the tasks are first released at the time of the call
+     */
+    void run() noexcept
+    {
+        if (m_task_count == 0)
+            return;
+
+        const std::chrono::nanoseconds start = m_clock.now();
+        for (size_t i = 0; i < m_task_count; i++) {
+            m_tasks[i].release = start;
+        }
+
+        m_running.store(true, std::memory_order_release);
+        while (m_running.load(std::memory_order_acquire)) {
+            if (!run_ready_task())
+                m_clock.sleep_until(get_next_release());
+        }
+    }
+
+    /**
+     * Make `run` return after the current task, or after the next release if sleeping
+     * @note Safe to call from a task or from another thread
+     */
+    void stop() noexcept
+    {
+        m_running.store(false, std::memory_order_release);
+    }
+
+    /**
+     * Get the statistics of the task
+     */
+    const task_stats& get_task_stats(size_t index) const noexcept
+    {
+        return m_tasks[index].stats;
+    }
+
+    /**
+     * Get the number of tasks
+     */
+    size_t get_task_count() const noexcept
+    {
+        return m_task_count;
+    }
+
+    /**
+     * Get maximum number of tasks
+     */
+    constexpr size_t get_capacity() const noexcept
+    {
+        return TASK_CAPACITY;
+    }
+
+private:
+    /**
+     * Run the most urgent task which was released
+     * @returns `false` if no task is ready
+     */
+    bool run_ready_task() noexcept
+    {
+        const std::chrono::nanoseconds now = m_clock.now();
+
+        for (size_t i = 0; i < m_task_count; i++) {
+            task_s& task = m_tasks[m_order[i]];
+            if (task.release > now)
+                continue;
+
+            const std::chrono::nanoseconds start = now;
+            task.fn();
+            const std::chrono::nanoseconds end = m_clock.now();
+
+            const std::chrono::nanoseconds deadline = task.release + task.period;
+            task.stats.m_counters.add(task_stats::RUNS);
+            task.stats.m_execution_time.set((end - start).count());
+            task.stats.m_jitter.set((start - task.release).count());
+
+            if (end > deadline)
+                task.stats.m_counters.add(task_stats::DEADLINE_MISSES);
+
+            // Skip the releases whose deadline has also passed
+            task.release = deadline;
+            if (end > task.release + task.period) {
+                const int64_t skipped = (end - task.release) / task.period;
+                task.release += skipped * task.period;
+                task.stats.m_counters.add(task_stats::DEADLINE_MISSES, skipped);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    std::chrono::nanoseconds get_next_release() const noexcept
+    {
+        std::chrono::nanoseconds next = std::chrono::nanoseconds::max();
+        for (size_t i = 0; i < m_task_count; i++) {
+            next = std::min(next, m_tasks[i].release);
+        }
+        return next;
+    }
+
+private:
+    rtos::clock& m_clock;
+    task_s m_tasks[TASK_CAPACITY];
+    // Task indices from the most urgent
+    size_t m_order[TASK_CAPACITY];
+    size_t m_task_count;
+    std::atomic<bool> m_running;
+};
+
+}
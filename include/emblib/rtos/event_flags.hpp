@@ -0,0 +1,47 @@
+#pragma once
+
+#include "emblib/io/types.hpp"
+#include <cstdint>
+
+namespace emblib::rtos {
+
+/**
+ * Set of flags which threads can wait on, one bit per event
+ */
+class event_flags {
+public:
+    /**
+     * Condition of a wait
+     */
+    enum class wait_e {
+        ANY,
+        ALL
+    };
+
+public:
+    virtual ~event_flags() = default;
+
+    /**
+     * Set the flags, waking up the threads waiting for them
+     */
+    virtual void set(uint32_t flags) noexcept = 0;
+
+    /**
+     * Clear the flags
+     */
+    virtual void clear(uint32_t flags) noexcept = 0;
+
+    /**
+     * Get the flags which are currently set
+     */
+    virtual uint32_t get() const noexcept = 0;
+
+    /**
+     * Wait until any or all of the flags in `mask` are set, and clear them
+     * @returns Flags of the mask which were set and are now cleared,
+     * 0 on timeout
+     */
+    virtual uint32_t wait(uint32_t mask, wait_e condition, io::timeout timeout) noexcept = 0;
+};
+
+}
@@ -1,12 +1,80 @@
 #pragma once
 
+#include "emblib/lockfree/backoff.hpp"
 #include <etl/tuple.h>
+#include <cstddef>
 
 namespace emblib::rtos {
 
+namespace details {
+
+/**
+ * Type erased reference to a lock, used to pick locks by a runtime index
+ */
+struct lock_ref_s {
+    void* lock;
+    void (*lock_fn)(void*);
+    bool (*try_lock_fn)(void*);
+    void (*unlock_fn)(void*);
+};
+
+template<typename lock_type>
+lock_ref_s make_lock_ref(lock_type& lock) noexcept
+{
+    return {
+        &lock,
+        [](void* ptr) { static_cast<lock_type*>(ptr)->lock(); },
+        [](void* ptr) { return static_cast<lock_type*>(ptr)->try_lock(); },
+        [](void* ptr) { static_cast<lock_type*>(ptr)->unlock(); }
+    };
+}
+
+/**
+ * Acquire all the locks without risk of dead-lock, the same as `std::lock`
+ *
+ * Blocks on one lock and tries to take the others. If any of them is taken,
+ * everything acquired so far is released and the next round starts by blocking
+ * on the lock which failed, so the thread waits for the lock held by someone
+ * else instead of spinning on try-locks. Rounds are separated by exponential
+ * backoff to let the other thread finish taking its locks.
+ */
+template<size_t COUNT>
+void lock_all(lock_ref_s (&locks)[COUNT])
+{
+    lockfree::backoff backoff;
+    size_t first = 0;
+
+    while (true) {
+        locks[first].lock_fn(locks[first].lock);
+
+        size_t failed = first;
+        for (size_t i = 1; i < COUNT; i++) {
+            const size_t index = (first + i) % COUNT;
+            if (!locks[index].try_lock_fn(locks[index].lock)) {
+                failed = index;
+                break;
+            }
+        }
+        if (failed == first)
+            return;
+
+        for (size_t index = first; index != failed; index = (index + 1) % COUNT) {
+            locks[index].unlock_fn(locks[index].lock);
+        }
+        first = failed;
+        backoff.pause();
+    }
+}
+
+}
+
 /**
  * Mutex lock which lasts from creation until the end of the
  * scope, with dead-lock prevention.
+ *
+ * Multiple locks are acquired with the try-and-back-off algorithm of
+ * `details::lock_all`, so threads taking the same locks in different
+ * order don't dead-lock. Locks are released in reverse order.
  */
 template<typename... lock_types>
 class scoped_lock {
@@ -14,7 +82,12 @@ public:
     explicit scoped_lock(lock_types&... locks) :
         m_locks(locks...)
     {
-        (locks.lock(), ...);
+        if constexpr (sizeof...(lock_types) == 1) {
+            (locks.lock(), ...);
+        } else if constexpr (sizeof...(lock_types) > 1) {
+            details::lock_ref_s refs[] = {details::make_lock_ref(locks)...};
+            details::lock_all(refs);
+        }
     }
 
     scoped_lock(const scoped_lock&) = delete;
@@ -37,4 +110,31 @@ private:
     etl::tuple<lock_types&...> m_locks;
 };
 
+/**
+ * Shared lock of a reader-writer lock which lasts
+ * from creation until the end of the scope
+ */
+template<typename lock_type>
+class shared_lock {
+public:
+    explicit shared_lock(lock_type& lock) :
+        m_lock(lock)
+    {
+        m_lock.lock_shared();
+    }
+
+    shared_lock(const shared_lock&) = delete;
+    shared_lock& operator=(const shared_lock&) = delete;
+    shared_lock(shared_lock&&) = delete;
+    shared_lock& operator=(shared_lock&&) = delete;
+
+    ~shared_lock()
+    {
+        m_lock.unlock_shared();
+    }
+
+private:
+    lock_type& m_lock;
+};
+
 }
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "emblib/lockfree/backoff.hpp"
+#include "emblib/lockfree/cache_line.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::rtos {
+
+/**
+ * Fair queue lock where every waiter spins on its own cache line
+ *
+ * Waiting threads form a linked list of nodes, and each of them spins on
+ * a flag in its own node until its predecessor hands the lock over. Only
+ * one thread is notified on release, so the cost of a handover doesn't grow
+ * with the number of waiters and the lock is granted in the order requested.
+ *
+ * Caller can supply the queue node, which must stay alive until the lock
+ * is released with the same node. Otherwise nodes come from a small per
+ * thread pool and the node of the owner is kept in the lock, so the
+ * interface is the same as for other locks and locks may be released
+ * in any order.
+ *
+ * @note A thread can hold or wait for at most `MAX_HELD_LOCKS` MCS locks
+ * with pool nodes at the same time
+ */
+class mcs_lock {
+public:
+    /**
+     * Queue node of a thread holding or waiting for the lock
+     */
+    struct alignas(lockfree::CACHE_LINE_SIZE) node_s {
+        std::atomic<node_s*> next;
+        std::atomic<bool> is_waiting;
+    };
+
+    static constexpr size_t MAX_HELD_LOCKS = 8;
+
+public:
+    mcs_lock() noexcept :
+        m_tail(nullptr),
+        m_owner(nullptr)
+    {}
+
+    /* Copy operations not allowed */
+    mcs_lock(const mcs_lock&) = delete;
+    mcs_lock& operator=(const mcs_lock&) = delete;
+
+    /* Move operations not allowed */
+    mcs_lock(mcs_lock&&) = delete;
+    mcs_lock& operator=(mcs_lock&&) = delete;
+
+    /**
+     * Wait in the queue until the lock is acquired
+     */
+    void lock() noexcept
+    {
+        node_s* node = alloc_node();
+        lock(*node);
+        m_owner = node;
+    }
+
+    /**
+     * Wait in the queue with the given node until the lock is acquired
+     */
+    void lock(node_s& node) noexcept
+    {
+        node.next.store(nullptr, std::memory_order_relaxed);
+        node.is_waiting.store(true, std::memory_order_relaxed);
+
+        node_s* prev = m_tail.exchange(&node, std::memory_order_acq_rel);
+        if (prev != nullptr) {
+            prev->next.store(&node, std::memory_order_release);
+            while (node.is_waiting.load(std::memory_order_acquire)) {
+                lockfree::cpu_relax();
+            }
+        }
+    }
+
+    /**
+     * Acquire the lock only if no one holds or waits for it
+     * @returns `true` if successful
+     */
+    bool try_lock() noexcept
+    {
+        node_s* node = alloc_node();
+        if (!try_lock(*node)) {
+            free_node(node);
+            return false;
+        }
+        m_owner = node;
+        return true;
+    }
+
+    /**
+     * Acquire the lock with the given node only if no one holds or waits for it
+     * @returns `true` if successful
+     */
+    bool try_lock(node_s& node) noexcept
+    {
+        node.next.store(nullptr, std::memory_order_relaxed);
+
+        node_s* expected = nullptr;
+        return m_tail.compare_exchange_strong(expected, &node, std::memory_order_acq_rel, std::memory_order_relaxed);
+    }
+
+    /**
+     * Release the lock to the next thread in the queue
+     * @note Must be called from the thread which acquired the lock
+     */
+    void unlock() noexcept
+    {
+        node_s* node = m_owner;
+        unlock(*node);
+        free_node(node);
+    }
+
+    /**
+     * Release the lock acquired with the given node to the next thread in the queue
+     */
+    void unlock(node_s& node) noexcept
+    {
+        node_s* next = node.next.load(std::memory_order_acquire);
+
+        if (next == nullptr) {
+            node_s* expected = &node;
+            if (m_tail.compare_exchange_strong(expected, nullptr, std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+            // Successor swapped the tail, but didn't link itself yet
+            while ((next = node.next.load(std::memory_order_acquire)) == nullptr) {
+                lockfree::cpu_relax();
+            }
+        }
+
+        next->is_waiting.store(false, std::memory_order_release);
+    }
+
+private:
+    static node_s* alloc_node() noexcept
+    {
+        // Thread holds or waits for more than `MAX_HELD_LOCKS` locks
+        assert(s_free_nodes != 0);
+        const size_t index = __builtin_ctz(s_free_nodes);
+        s_free_nodes &= ~(1u << index);
+        return &s_nodes[index];
+    }
+
+    static void free_node(node_s* node) noexcept
+    {
+        s_free_nodes |= 1u << (node - s_nodes);
+    }
+
+private:
+    static inline thread_local node_s s_nodes[MAX_HELD_LOCKS];
+    static inline thread_local uint32_t s_free_nodes = (1u << MAX_HELD_LOCKS) - 1;
+
+    alignas(lockfree::CACHE_LINE_SIZE) std::atomic<node_s*> m_tail;
+    // Only accessed by the owner
+    node_s* m_owner;
+};
+
+}
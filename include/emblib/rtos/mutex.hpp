@@ -0,0 +1,34 @@
+#pragma once
+
+namespace emblib::rtos {
+
+/**
+ * Mutex which puts the waiting threads to sleep
+ *
+ * Has the same interface as the spinlocks, so it can be used with `scoped_lock`.
+ * Prefer it over spinlocks when the lock may be held for long, or when the
+ * owner can be preempted by the waiting threads.
+ */
+class mutex {
+public:
+    virtual ~mutex() = default;
+
+    /**
+     * Acquire the mutex, sleeping while it's taken
+     */
+    virtual void lock() noexcept = 0;
+
+    /**
+     * Try to acquire the mutex once
+     * @returns `true` if successful
+     */
+    virtual bool try_lock() noexcept = 0;
+
+    /**
+     * Release the mutex
+     * @note Must be called from the thread which acquired it
+     */
+    virtual void unlock() noexcept = 0;
+};
+
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "mutex.hpp"
+
+namespace emblib::rtos {
+
+/**
+ * Mutex with priority inheritance
+ *
+ * While a thread waits for the mutex, the owner runs with the priority of the
+ * highest priority waiter. A low priority owner can't then be preempted by
+ * medium priority threads while a high priority thread waits for it, which
+ * bounds the priority inversion to the length of the critical section.
+ *
+ * @note Use it instead of a spinlock for resources shared between
+ * threads of different priorities, such as a bus used by several drivers
+ */
+class pi_mutex : public mutex {};
+
+}
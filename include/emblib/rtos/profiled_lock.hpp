@@ -0,0 +1,178 @@
+#pragma once
+
+#include "emblib/metrics/counters.hpp"
+#include "emblib/metrics/histogram.hpp"
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace emblib::rtos {
+
+/**
+ * Flag enabling the lock profiling
+ * @note Enabled by defining `EMBLIB_LOCK_PROFILING`
+ */
+#ifdef EMBLIB_LOCK_PROFILING
+constexpr bool LOCK_PROFILING_IS_ENABLED = true;
+#else
+constexpr bool LOCK_PROFILING_IS_ENABLED = false;
+#endif
+
+/**
+ * Lock which records how long threads wait for it and how long they hold it
+ *
+ * Wraps any lock with the `lock/try_lock/unlock` interface, so it can be
+ * used with `scoped_lock` in place of the lock itself. Times are recorded
+ * in nanoseconds, per lock instance, in histograms which can be registered
+ * in `metrics::registry` to find the most contended and the longest critical
+ * sections. A successful `try_lock` is recorded as a wait of 0.
+ *
+ * If profiling is disabled the histograms are empty types and the lock
+ * calls are forwarded without reading the clock, so locks can be declared
+ * as profiled everywhere and the profiling is enabled for the whole build.
+ *
+ * @note Only exclusive locking is profiled, shared locking of a wrapped
+ * read-write lock is forwarded as is so it can be used with `shared_lock`
+ */
+template <typename lock_type, bool IS_ENABLED = LOCK_PROFILING_IS_ENABLED>
+class profiled_lock {
+    using clock_t = std::chrono::steady_clock;
+
+    struct profile_s {
+        metrics::histogram<> wait_time;
+        metrics::histogram<> hold_time;
+        // Written only by the owner of the lock
+        clock_t::time_point acquired;
+    };
+
+    struct null_profile_s {};
+
+public:
+    using histogram_t = std::conditional_t<IS_ENABLED, metrics::histogram<>, metrics::null_histogram<>>;
+
+public:
+    profiled_lock() = default;
+
+    /* Copy operations not allowed */
+    profiled_lock(const profiled_lock&) = delete;
+    profiled_lock& operator=(const profiled_lock&) = delete;
+
+    /* Move operations not allowed */
+    profiled_lock(profiled_lock&&) = delete;
+    profiled_lock& operator=(profiled_lock&&) = delete;
+
+    /**
+     * Acquire the lock, recording the time spent waiting
+     */
+    void lock() noexcept
+    {
+        if constexpr (IS_ENABLED) {
+            const auto start = clock_t::now();
+            m_lock.lock();
+            m_profile.acquired = clock_t::now();
+            m_profile.wait_time.record(get_nanoseconds(m_profile.acquired - start));
+        } else {
+            m_lock.lock();
+        }
+    }
+
+    /**
+     * Try to acquire the lock once
+     * @returns `true` if successful
+     */
+    bool try_lock() noexcept
+    {
+        if (!m_lock.try_lock())
+            return false;
+
+        if constexpr (IS_ENABLED) {
+            m_profile.acquired = clock_t::now();
+            m_profile.wait_time.record(0);
+        }
+        return true;
+    }
+
+    /**
+     * Release the lock, recording the time it was held
+     */
+    void unlock() noexcept
+    {
+        if constexpr (IS_ENABLED)
+            m_profile.hold_time.record(get_nanoseconds(clock_t::now() - m_profile.acquired));
+        m_lock.unlock();
+    }
+
+    /**
+     * Acquire the lock for reading, without profiling
+     * @note Only available if the wrapped lock supports shared locking
+     */
+    template <typename type = lock_type>
+    auto lock_shared() noexcept -> decltype(std::declval<type&>().lock_shared())
+    {
+        m_lock.lock_shared();
+    }
+
+    /**
+     * Try to acquire the lock for reading once, without profiling
+     * @returns `true` if successful
+     */
+    template <typename type = lock_type>
+    auto try_lock_shared() noexcept -> decltype(std::declval<type&>().try_lock_shared())
+    {
+        return m_lock.try_lock_shared();
+    }
+
+    /**
+     * Release the lock acquired for reading
+     */
+    template <typename type = lock_type>
+    auto unlock_shared() noexcept -> decltype(std::declval<type&>().unlock_shared())
+    {
+        m_lock.unlock_shared();
+    }
+
+    /**
+     * Get the histogram of waits for the lock, in nanoseconds
+     */
+    const histogram_t& get_wait_time() const noexcept
+    {
+        if constexpr (IS_ENABLED)
+            return m_profile.wait_time;
+        else
+            return s_null_histogram;
+    }
+
+    /**
+     * Get the histogram of times the lock was held, in nanoseconds
+     */
+    const histogram_t& get_hold_time() const noexcept
+    {
+        if constexpr (IS_ENABLED)
+            return m_profile.hold_time;
+        else
+            return s_null_histogram;
+    }
+
+    /**
+     * Access the wrapped lock
+     */
+    lock_type& get_lock() noexcept
+    {
+        return m_lock;
+    }
+
+private:
+    static uint64_t get_nanoseconds(clock_t::duration duration) noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+private:
+    static inline const metrics::null_histogram<> s_null_histogram{};
+
+    lock_type m_lock;
+    EMBLIB_NO_UNIQUE_ADDRESS std::conditional_t<IS_ENABLED, profile_s, null_profile_s> m_profile;
+};
+
+}
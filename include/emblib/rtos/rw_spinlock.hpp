@@ -0,0 +1,120 @@
+#pragma once
+
+#include "emblib/lockfree/backoff.hpp"
+#include <atomic>
+#include <cstdint>
+
+namespace emblib::rtos {
+
+/**
+ * Reader-writer spinlock preferring writers
+ *
+ * Any number of readers can hold the lock at the same time, while a writer
+ * holds it exclusively. A waiting writer blocks new readers from entering,
+ * so a steady stream of readers can't starve it.
+ *
+ * @note Readers still update the shared state on every acquisition, so for
+ * small data read much more often than written prefer `seqlock`
+ */
+class rw_spinlock {
+    static constexpr uint32_t WRITER = 1;
+    static constexpr uint32_t WRITER_PENDING = 2;
+    static constexpr uint32_t READER = 4;
+
+    /**
+     * Upper bound of the backoff, in pause hints
+     */
+    static constexpr uint32_t MAX_BACKOFF_SPINS = 256;
+
+public:
+    rw_spinlock() noexcept :
+        m_state(0)
+    {}
+
+    /* Copy operations not allowed */
+    rw_spinlock(const rw_spinlock&) = delete;
+    rw_spinlock& operator=(const rw_spinlock&) = delete;
+
+    /* Move operations not allowed */
+    rw_spinlock(rw_spinlock&&) = delete;
+    rw_spinlock& operator=(rw_spinlock&&) = delete;
+
+    /**
+     * Acquire exclusive access, waiting for the readers to leave
+     */
+    void lock() noexcept
+    {
+        lockfree::backoff backoff(MAX_BACKOFF_SPINS);
+        while (true) {
+            uint32_t state = m_state.load(std::memory_order_relaxed);
+            if ((state & ~WRITER_PENDING) == 0) {
+                if (m_state.compare_exchange_weak(state, WRITER, std::memory_order_acquire, std::memory_order_relaxed))
+                    return;
+            } else if (!(state & WRITER_PENDING)) {
+                // Stop new readers from entering, other waiting writers set it again if cleared
+                m_state.fetch_or(WRITER_PENDING, std::memory_order_relaxed);
+            }
+            backoff.pause();
+        }
+    }
+
+    /**
+     * Try to acquire exclusive access once
+     * @returns `true` if successful
+     */
+    bool try_lock() noexcept
+    {
+        uint32_t state = m_state.load(std::memory_order_relaxed);
+        return (state & ~WRITER_PENDING) == 0 &&
+            m_state.compare_exchange_strong(state, WRITER, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    /**
+     * Release exclusive access
+     * @note Use only if previously acquired with `lock` or `try_lock`
+     */
+    void unlock() noexcept
+    {
+        m_state.fetch_and(~WRITER, std::memory_order_release);
+    }
+
+    /**
+     * Acquire shared access, waiting while a writer holds or waits for the lock
+     */
+    void lock_shared() noexcept
+    {
+        lockfree::backoff backoff(MAX_BACKOFF_SPINS);
+        while (!try_lock_shared()) {
+            backoff.pause();
+        }
+    }
+
+    /**
+     * Try to acquire shared access
+     * @returns `false` if a writer holds or waits for the lock
+     */
+    bool try_lock_shared() noexcept
+    {
+        uint32_t state = m_state.load(std::memory_order_relaxed);
+        while (!(state & (WRITER | WRITER_PENDING))) {
+            // Only fails if another reader entered or left, so retry right away
+            if (m_state.compare_exchange_weak(state, state + READER, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * Release shared access
+     * @note Use only if previously acquired with `lock_shared` or `try_lock_shared`
+     */
+    void unlock_shared() noexcept
+    {
+        m_state.fetch_sub(READER, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> m_state;
+};
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "emblib/io/types.hpp"
+#include <cstddef>
+
+namespace emblib::rtos {
+
+/**
+ * Counting semaphore
+ */
+class semaphore {
+public:
+    virtual ~semaphore() = default;
+
+    /**
+     * Take a unit, waiting up to `timeout` for one to be given
+     * @returns `false` on timeout
+     * @note `io::timeout::min()` only tries once, `io::timeout::max()` waits forever
+     */
+    virtual bool take(io::timeout timeout) noexcept = 0;
+
+    /**
+     * Give a unit, waking up a waiting thread if there is one
+     */
+    virtual void give() noexcept = 0;
+
+    /**
+     * Get the number of available units
+     */
+    virtual size_t get_count() const noexcept = 0;
+};
+
+}
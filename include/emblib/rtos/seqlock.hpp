@@ -0,0 +1,116 @@
+#pragma once
+
+#include "spinlock.hpp"
+#include "emblib/lockfree/seqlock_cell.hpp"
+#include <cstddef>
+
+namespace emblib::rtos {
+
+/**
+ * Value shared between many readers and a few writers, read without locking
+ *
+ * Seqlock cell whose writers are serialized by `lock_type`, so readers
+ * never write to shared memory and scale with the number of cores.
+ *
+ * The seqlock itself is a lock for the writers, so it can be used with
+ * `scoped_lock` to modify the value in place through `get`.
+ *
+ * @note Value is copied bytewise, so it must be trivially copyable. Readers
+ * spin while a write is in progress, so writes should be short and rare.
+ */
+template <typename data_type, typename lock_type = spinlock>
+class seqlock {
+public:
+    explicit seqlock(const data_type& initial = data_type()) :
+        m_cell(initial)
+    {}
+
+    /* Copy operations not allowed */
+    seqlock(const seqlock&) = delete;
+    seqlock& operator=(const seqlock&) = delete;
+
+    /* Move operations not allowed */
+    seqlock(seqlock&&) = delete;
+    seqlock& operator=(seqlock&&) = delete;
+
+    /**
+     * Get a consistent copy of the value
+     */
+    data_type read() const noexcept
+    {
+        return m_cell.read();
+    }
+
+    /**
+     * Try to copy the value once
+     * @returns `false` if a write was in progress, in which case the
+     * buffer content is not valid
+     */
+    bool try_read(data_type& buffer) const noexcept
+    {
+        return m_cell.try_read(buffer);
+    }
+
+    /**
+     * Replace the value
+     */
+    void write(const data_type& value) noexcept
+    {
+        m_lock.lock();
+        m_cell.write(value);
+        m_lock.unlock();
+    }
+
+    /**
+     * Start modifying the value, waiting for other writers
+     */
+    void lock() noexcept
+    {
+        m_lock.lock();
+        m_cell.begin_write();
+    }
+
+    /**
+     * Try to start modifying the value
+     * @returns `true` if successful
+     */
+    bool try_lock() noexcept
+    {
+        if (!m_lock.try_lock())
+            return false;
+        m_cell.begin_write();
+        return true;
+    }
+
+    /**
+     * Publish the modified value to the readers
+     */
+    void unlock() noexcept
+    {
+        m_cell.end_write();
+        m_lock.unlock();
+    }
+
+    /**
+     * Access the value for modification
+     * @note Only while locked, readers must use `read`
+     */
+    data_type& get() noexcept
+    {
+        return m_cell.get();
+    }
+
+    /**
+     * Get the number of completed writes
+     */
+    size_t get_write_count() const noexcept
+    {
+        return m_cell.get_write_count();
+    }
+
+private:
+    lockfree::seqlock_cell<data_type> m_cell;
+    lock_type m_lock;
+};
+
+}
@@ -1,10 +1,27 @@
 #pragma once
 
+#include "emblib/lockfree/backoff.hpp"
 #include <atomic>
+#include <cstdint>
 
 namespace emblib::rtos {
 
+/**
+ * Test and test-and-set spinlock with exponential backoff
+ *
+ * Waiting threads only read the lock, which keeps the cache line shared
+ * between them, and attempt the exchange once it looks free. After every
+ * failed attempt the thread backs off for exponentially longer, up to a bound,
+ * so a released lock isn't hit by all the waiting threads at the same time.
+ *
+ * @note Not fair, a thread can be overtaken by others any number of times
+ */
 class spinlock {
+    /**
+     * Upper bound of the backoff, in pause hints
+     */
+    static constexpr uint32_t MAX_BACKOFF_SPINS = 256;
+
 public:
     spinlock() :
         m_lock(false)
@@ -20,12 +37,20 @@ public:
 
     /**
      * Try to acquire the lock in a loop until successful
-     * @todo Add an inner loop to just read without exchange
-     * to reduce cache strain on multi core systems
      */
     void lock() noexcept
     {
-        while (m_lock.exchange(true, std::memory_order_acquire)) {}
+        lockfree::backoff backoff(MAX_BACKOFF_SPINS);
+        while (m_lock.exchange(true, std::memory_order_acquire)) {
+            // Only a failed exchange means contention, so the backoff grows once per attempt
+            backoff.pause();
+
+            // Spin on reads only, so waiting doesn't invalidate the owner's cache line,
+            // and attempt the exchange as soon as the lock looks free
+            while (m_lock.load(std::memory_order_relaxed)) {
+                lockfree::cpu_relax();
+            }
+        }
     }
 
     /**
@@ -34,7 +59,7 @@ public:
      */
     bool try_lock() noexcept
     {
-        return !m_lock.exchange(true, std::memory_order_acquire);
+        return !m_lock.load(std::memory_order_relaxed) && !m_lock.exchange(true, std::memory_order_acquire);
     }
 
     /**
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "emblib/lockfree/allocator.hpp"
+#include "emblib/lockfree/cache_line.hpp"
+#include "emblib/lockfree/mpmc_queue.hpp"
+#include "emblib/lockfree/work_stealing_deque.hpp"
+#include <etl/delegate.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace emblib::rtos {
+
+/**
+ * Work stealing scheduler for a fixed number of workers
+ *
+ * Each worker owns a deque of tasks which it pushes to and pops from, and
+ * idle workers steal tasks from the other deques. Tasks submitted from
+ * threads which aren't workers of this scheduler go through a shared
+ * injection queue. Task descriptors are allocated from a fixed pool, so
+ * scheduling doesn't use the heap.
+ *
+ * The scheduler doesn't create threads, instead each worker thread is
+ * expected to call `run` with its index. This leaves the choice of thread
+ * API, priority and affinity to the application.
+ *
+ * @note Task callbacks are delegates, so the callable objects they are
+ * created from must outlive the execution of the task
+ */
+template <size_t WORKER_COUNT, size_t TASK_CAPACITY = 256, size_t DEQUE_CAPACITY = 256>
+class task_scheduler {
+    static_assert(WORKER_COUNT > 0);
+
+    struct task_s {
+        etl::delegate<void()> fn;
+        etl::delegate<void(size_t, size_t)> range_fn;
+        size_t begin;
+        size_t end;
+        std::atomic<size_t>* pending;
+    };
+
+    struct alignas(lockfree::CACHE_LINE_SIZE) worker_s {
+        lockfree::work_stealing_deque<task_s*, DEQUE_CAPACITY> deque;
+    };
+
+public:
+    /**
+     * Index returned for threads which are not workers of this scheduler
+     */
+    static constexpr size_t NO_WORKER = WORKER_COUNT;
+
+    /**
+     * Task callback
+     */
+    using task_fn_t = etl::delegate<void()>;
+
+    /**
+     * Callback processing the index range [begin, end)
+     */
+    using range_fn_t = etl::delegate<void(size_t, size_t)>;
+
+public:
+    task_scheduler() :
+        m_running(true)
+    {}
+
+    task_scheduler(const task_scheduler&) = delete;
+    task_scheduler& operator=(const task_scheduler&) = delete;
+    task_scheduler(task_scheduler&&) = delete;
+    task_scheduler& operator=(task_scheduler&&) = delete;
+
+    /**
+     * Execute tasks on the calling thread until `stop` is called
+     * @param worker_index Unique index of the worker in range [0, WORKER_COUNT)
+     * @param idle_fn Called whenever there is no task to execute, for example
+     * to yield or sleep. If not valid, the worker spins.
+     */
+    void run(size_t worker_index, etl::delegate<void()> idle_fn = {}) noexcept
+    {
+        s_scheduler = this;
+        s_worker_index = worker_index;
+
+        while (m_running.load(std::memory_order_acquire)) {
+            if (!execute_one(worker_index) && idle_fn.is_valid())
+                idle_fn();
+        }
+
+        s_scheduler = nullptr;
+        s_worker_index = NO_WORKER;
+    }
+
+    /**
+     * Make all workers return from `run` once their current task is done
+     * @note Tasks which weren't executed are dropped
+     */
+    void stop() noexcept
+    {
+        m_running.store(false, std::memory_order_release);
+    }
+
+    /**
+     * Submit a task for execution
+     * @returns `false` if there was no space for the task
+     */
+    bool submit(task_fn_t fn) noexcept
+    {
+        task_s* task = create_task();
+        if (task == nullptr)
+            return false;
+
+        task->fn = fn;
+        if (!enqueue(task)) {
+            destroy_task(task);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Call `fn` for consecutive chunks of at most `grain` indices covering
+     * the range [begin, end), distributed between the workers
+     *
+     * Returns once all the chunks are processed. The calling thread executes
+     * tasks while waiting, so this can be called both from a task and from a
+     * thread which is not a worker. Chunks which can't be scheduled because the
+     * task pool or the deque is full are processed by the calling thread.
+     */
+    void parallel_for(size_t begin, size_t end, size_t grain, range_fn_t fn) noexcept
+    {
+        grain = std::max<size_t>(grain, 1);
+        std::atomic<size_t> pending(0);
+
+        for (size_t chunk_begin = begin; chunk_begin < end; chunk_begin += grain) {
+            const size_t chunk_end = std::min(end, chunk_begin + std::min(grain, end - chunk_begin));
+            task_s* task = create_task();
+
+            if (task != nullptr) {
+                task->range_fn = fn;
+                task->begin = chunk_begin;
+                task->end = chunk_end;
+                task->pending = &pending;
+
+                pending.fetch_add(1, std::memory_order_relaxed);
+                if (enqueue(task))
+                    continue;
+
+                pending.fetch_sub(1, std::memory_order_relaxed);
+                destroy_task(task);
+            }
+            fn(chunk_begin, chunk_end);
+        }
+
+        // Help with executing tasks until all the chunks are done
+        const size_t worker_index = get_worker_index();
+        while (pending.load(std::memory_order_acquire) != 0) {
+            execute_one(worker_index);
+        }
+    }
+
+    /**
+     * Get the index of the calling worker, or `NO_WORKER` if the calling
+     * thread is not a worker of this scheduler
+     */
+    size_t get_worker_index() const noexcept
+    {
+        return s_scheduler == this ? s_worker_index : NO_WORKER;
+    }
+
+    /**
+     * Get the number of tasks which are scheduled or executing
+     */
+    size_t get_task_count() const noexcept
+    {
+        return m_tasks.get_allocation_count();
+    }
+
+private:
+    /**
+     * Find and execute a single task
+     * @returns `false` if there were no tasks available
+     */
+    bool execute_one(size_t worker_index) noexcept
+    {
+        task_s* task;
+        if (!find_task(worker_index, task))
+            return false;
+
+        // Free the descriptor before executing, so the task can schedule more work
+        task_s local = *task;
+        destroy_task(task);
+
+        if (local.fn.is_valid())
+            local.fn();
+        else
+            local.range_fn(local.begin, local.end);
+
+        if (local.pending != nullptr)
+            local.pending->fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    bool find_task(size_t worker_index, task_s*& task) noexcept
+    {
+        if (worker_index != NO_WORKER && m_workers[worker_index].deque.pop(task))
+            return true;
+
+        if (m_injected.pop(task))
+            return true;
+
+        // Steal starting from the next worker, to spread thieves between victims
+        for (size_t i = 1; i <= WORKER_COUNT; i++) {
+            const size_t victim = (worker_index + i) % WORKER_COUNT;
+            if (victim != worker_index && m_workers[victim].deque.steal(task))
+                return true;
+        }
+        return false;
+    }
+
+    bool enqueue(task_s* task) noexcept
+    {
+        const size_t worker_index = get_worker_index();
+        if (worker_index != NO_WORKER)
+            return m_workers[worker_index].deque.push(task);
+        return m_injected.push(task);
+    }
+
+    task_s* create_task() noexcept
+    {
+        task_s* task = m_tasks.alloc();
+        if (task != nullptr)
+            new (task) task_s{{}, {}, 0, 0, nullptr};
+        return task;
+    }
+
+    void destroy_task(task_s* task) noexcept
+    {
+        task->~task_s();
+        m_tasks.dealloc(task);
+    }
+
+private:
+    static inline thread_local const task_scheduler* s_scheduler = nullptr;
+    static inline thread_local size_t s_worker_index = NO_WORKER;
+
+    worker_s m_workers[WORKER_COUNT];
+    lockfree::mpmc_queue<task_s*, TASK_CAPACITY> m_injected;
+    lockfree::allocator<task_s, TASK_CAPACITY> m_tasks;
+
+    alignas(lockfree::CACHE_LINE_SIZE) std::atomic<bool> m_running;
+};
+
+}
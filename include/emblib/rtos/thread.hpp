@@ -0,0 +1,77 @@
+#pragma once
+
+#include <etl/delegate.h>
+#include <etl/span.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace emblib::rtos {
+
+/**
+ * Function executed by a thread
+ */
+using thread_fn_t = etl::delegate<void()>;
+
+/**
+ * Parameters of a thread, fields left at their defaults
+ * keep the default behavior of the platform
+ */
+struct thread_config_s {
+    /**
+     * Name shown by debuggers and system tools
+     */
+    const char* name = nullptr;
+
+    /**
+     * Real-time priority where higher is more urgent,
+     * 0 for the default time-shared scheduling
+     */
+    int priority = 0;
+
+    /**
+     * Mask of the CPUs the thread may run on, 0 for any
+     */
+    uint32_t affinity = 0;
+
+    /**
+     * Statically allocated stack, if empty the platform allocates one
+     * @note Must outlive the thread
+     */
+    etl::span<uint8_t> stack = {};
+};
+
+/**
+ * Thread of execution
+ *
+ * Implementations start the thread on construction with the function and
+ * the configuration, and join it on destruction.
+ */
+class thread {
+public:
+    virtual ~thread() = default;
+
+    /**
+     * Check if the thread was created with the requested configuration
+     */
+    virtual bool is_valid() const noexcept = 0;
+
+    /**
+     * Wait for the thread function to return
+     * @note Has no effect if already joined
+     */
+    virtual void join() noexcept = 0;
+
+    /**
+     * Change the priority of a running thread
+     * @returns `false` if not permitted or not supported
+     */
+    virtual bool set_priority(int priority) noexcept = 0;
+
+    /**
+     * Change the CPUs a running thread may run on
+     * @returns `false` if not permitted or not supported
+     */
+    virtual bool set_affinity(uint32_t affinity) noexcept = 0;
+};
+
+}
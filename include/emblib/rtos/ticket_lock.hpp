@@ -0,0 +1,88 @@
+#pragma once
+
+#include "emblib/lockfree/backoff.hpp"
+#include "emblib/lockfree/cache_line.hpp"
+#include <atomic>
+#include <cstdint>
+
+namespace emblib::rtos {
+
+/**
+ * Fair spinlock granting the lock in the order it was requested
+ *
+ * Each thread takes a ticket and waits until it's being served, so no thread
+ * can be overtaken and the wait is bounded by the number of threads ahead.
+ * Waiters back off in proportion to their distance from the head of the queue,
+ * which keeps the polling of the shared counter low under contention.
+ *
+ * @note All the waiters poll the same cache line, so with many cores
+ * prefer `mcs_lock` where each waiter spins on its own
+ */
+class ticket_lock {
+    /**
+     * Pause hints per thread waiting ahead before polling again
+     */
+    static constexpr uint32_t BACKOFF_PER_WAITER = 32;
+
+public:
+    ticket_lock() noexcept :
+        m_next(0),
+        m_serving(0)
+    {}
+
+    /* Copy operations not allowed */
+    ticket_lock(const ticket_lock&) = delete;
+    ticket_lock& operator=(const ticket_lock&) = delete;
+
+    /* Move operations not allowed */
+    ticket_lock(ticket_lock&&) = delete;
+    ticket_lock& operator=(ticket_lock&&) = delete;
+
+    /**
+     * Wait in the queue until the lock is acquired
+     */
+    void lock() noexcept
+    {
+        const uint32_t ticket = m_next.fetch_add(1, std::memory_order_relaxed);
+
+        while (true) {
+            const uint32_t serving = m_serving.load(std::memory_order_acquire);
+            if (serving == ticket)
+                return;
+
+            // Wraps correctly, the distance is always smaller than the number of threads
+            const uint32_t ahead = ticket - serving;
+            for (uint32_t i = 0; i < ahead * BACKOFF_PER_WAITER; i++) {
+                lockfree::cpu_relax();
+            }
+        }
+    }
+
+    /**
+     * Acquire the lock only if no one holds or waits for it
+     * @returns `true` if successful
+     */
+    bool try_lock() noexcept
+    {
+        uint32_t ticket = m_serving.load(std::memory_order_relaxed);
+        return m_next.compare_exchange_strong(ticket, ticket + 1,
+                                              std::memory_order_acquire,
+                                              std::memory_order_relaxed);
+    }
+
+    /**
+     * Release the lock to the next thread in the queue
+     * @note Use only if previously acquired the lock
+     */
+    void unlock() noexcept
+    {
+        // Only the owner writes to the counter, so no read-modify-write is needed
+        m_serving.store(m_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    alignas(lockfree::CACHE_LINE_SIZE) std::atomic<uint32_t> m_next;
+    alignas(lockfree::CACHE_LINE_SIZE) std::atomic<uint32_t> m_serving;
+};
+
+}
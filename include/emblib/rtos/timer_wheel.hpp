@@ -0,0 +1,267 @@
+#pragma once
+
+#include "emblib/lockfree/allocator.hpp"
+#include <etl/delegate.h>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace emblib::rtos {
+
+/**
+ * Timer expiration callback
+ */
+using timer_cb = etl::delegate<void()>;
+
+/**
+ * Hierarchical timer wheel with a fixed number of timers
+ *
+ * Time is measured in ticks, and the wheel is driven by calling `advance`
+ * for every elapsed tick, for example from a periodic hardware timer or a
+ * `timerfd`. Each level has `2^SLOT_BITS` slots, and every slot of a level
+ * covers as many ticks as the whole level below it. Timers are placed in
+ * the lowest level which covers their deadline and move down a level when
+ * the wheel reaches their slot, so starting and canceling a timer is O(1)
+ * and every tick only touches the timers which are due.
+ *
+ * Deadlines past the range of the top level are placed in its farthest slot
+ * and reinserted until they come into range.
+ *
+ * @note Not thread safe. Timers should be started and canceled from the
+ * thread which advances the wheel, for example from the callbacks.
+ */
+template <size_t CAPACITY, size_t SLOT_BITS = 6, size_t LEVEL_COUNT = 4>
+class timer_wheel {
+    static_assert(SLOT_BITS > 0 && LEVEL_COUNT > 0 && SLOT_BITS * LEVEL_COUNT < 64);
+
+    static constexpr size_t SLOT_COUNT = size_t(1) << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOT_COUNT - 1;
+    static constexpr uint64_t MAX_DELAY = (uint64_t(1) << (SLOT_BITS * LEVEL_COUNT)) - 1;
+
+    struct node_s {
+        // Callback is the first member, since the allocator reuses the first
+        // bytes of free nodes, so the id of a freed node stays cleared
+        timer_cb cb;
+        node_s* next;
+        node_s** pprev;
+        uint64_t expiry;
+        uint64_t period;
+        uint32_t id;
+    };
+
+public:
+    /**
+     * Handle of a started timer used to cancel it
+     *
+     * Handle stays safe to use after the timer expired or was canceled,
+     * in which case canceling it has no effect.
+     */
+    class handle {
+    public:
+        handle() noexcept = default;
+
+        /**
+         * Check if the handle refers to a timer which was started
+         */
+        bool is_valid() const noexcept
+        {
+            return m_node != nullptr;
+        }
+
+    private:
+        friend class timer_wheel;
+
+        handle(node_s* node, uint32_t id) noexcept :
+            m_node(node),
+            m_id(id)
+        {}
+
+        node_s* m_node = nullptr;
+        uint32_t m_id = 0;
+    };
+
+public:
+    timer_wheel() noexcept :
+        m_slots{},
+        m_now(0),
+        m_next_id(1)
+    {}
+
+    timer_wheel(const timer_wheel&) = delete;
+    timer_wheel& operator=(const timer_wheel&) = delete;
+    timer_wheel(timer_wheel&&) = delete;
+    timer_wheel& operator=(timer_wheel&&) = delete;
+
+    /**
+     * Start a timer which calls `cb` after `delay` ticks
+     * @param period If not 0, the timer restarts every `period` ticks after
+     * the first expiration until it's canceled
+     * @returns Handle of the timer, not valid if there was no space for it
+     * @note Delay of 0 is rounded up to the next tick
+     */
+    handle start(uint64_t delay, timer_cb cb, uint64_t period = 0) noexcept
+    {
+        node_s* node = m_nodes.alloc();
+        if (node == nullptr)
+            return {};
+
+        new (node) node_s{cb, nullptr, nullptr, m_now + (delay > 0 ? delay : 1), period, get_next_id()};
+        insert(node);
+        return {node, node->id};
+    }
+
+    /**
+     * Stop the timer if it's still running
+     * @returns `true` if the timer was running
+     */
+    bool cancel(handle& timer) noexcept
+    {
+        const bool running = is_running(timer);
+        if (running) {
+            unlink(timer.m_node);
+            destroy(timer.m_node);
+        }
+        timer = {};
+        return running;
+    }
+
+    /**
+     * Check if the timer is waiting to expire
+     * @note Periodic timers are running until canceled
+     */
+    bool is_running(const handle& timer) const noexcept
+    {
+        return timer.m_node != nullptr && timer.m_node->id == timer.m_id;
+    }
+
+    /**
+     * Move the time forward by `ticks`, calling the callbacks
+     * of the timers which expire in the meantime in order
+     */
+    void advance(uint64_t ticks = 1) noexcept
+    {
+        for (; ticks > 0; ticks--) {
+            m_now++;
+            cascade();
+            expire(m_slots[0][m_now & SLOT_MASK]);
+        }
+    }
+
+    /**
+     * Get the number of ticks elapsed since construction
+     */
+    uint64_t get_time() const noexcept
+    {
+        return m_now;
+    }
+
+    /**
+     * Get the number of running timers
+     */
+    size_t get_timer_count() const noexcept
+    {
+        return m_nodes.get_allocation_count();
+    }
+
+    /**
+     * Get maximum number of running timers
+     */
+    constexpr size_t get_capacity() const noexcept
+    {
+        return CAPACITY;
+    }
+
+private:
+    void insert(node_s* node) noexcept
+    {
+        const uint64_t delay = node->expiry - m_now;
+        const uint64_t expiry = delay > MAX_DELAY ? m_now + MAX_DELAY : node->expiry;
+
+        // Lowest level whose range covers the delay
+        size_t level = 0;
+        while (level + 1 < LEVEL_COUNT && (delay >> (SLOT_BITS * (level + 1))) > 0) {
+            level++;
+        }
+
+        node_s*& slot = m_slots[level][(expiry >> (SLOT_BITS * level)) & SLOT_MASK];
+        node->next = slot;
+        node->pprev = &slot;
+        if (slot != nullptr)
+            slot->pprev = &node->next;
+        slot = node;
+    }
+
+    void unlink(node_s* node) noexcept
+    {
+        *node->pprev = node->next;
+        if (node->next != nullptr)
+            node->next->pprev = node->pprev;
+    }
+
+    /**
+     * Move the timers from the slots of the upper levels reached at this tick
+     */
+    void cascade() noexcept
+    {
+        for (size_t level = 1; level < LEVEL_COUNT; level++) {
+            if (((m_now >> (SLOT_BITS * (level - 1))) & SLOT_MASK) != 0)
+                return;
+
+            node_s*& slot = m_slots[level][(m_now >> (SLOT_BITS * level)) & SLOT_MASK];
+            node_s* node = slot;
+            slot = nullptr;
+
+            while (node != nullptr) {
+                node_s* next = node->next;
+                insert(node);
+                node = next;
+            }
+        }
+    }
+
+    void expire(node_s*& slot) noexcept
+    {
+        // Detach the slot, so callbacks can safely cancel timers which are due
+        node_s* pending = slot;
+        slot = nullptr;
+        if (pending != nullptr)
+            pending->pprev = &pending;
+
+        while (pending != nullptr) {
+            node_s* node = pending;
+            unlink(node);
+            const timer_cb cb = node->cb;
+
+            if (node->period > 0) {
+                node->expiry += node->period;
+                insert(node);
+            } else {
+                destroy(node);
+            }
+            cb();
+        }
+    }
+
+    void destroy(node_s* node) noexcept
+    {
+        node->id = 0;
+        node->~node_s();
+        m_nodes.dealloc(node);
+    }
+
+    uint32_t get_next_id() noexcept
+    {
+        // Id 0 marks free nodes
+        if (m_next_id == 0)
+            m_next_id++;
+        return m_next_id++;
+    }
+
+private:
+    lockfree::allocator<node_s, CAPACITY> m_nodes;
+    node_s* m_slots[LEVEL_COUNT][SLOT_COUNT];
+    uint64_t m_now;
+    uint32_t m_next_id;
+};
+
+}
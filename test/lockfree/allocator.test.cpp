@@ -1,5 +1,8 @@
 #include "emblib/lockfree/allocator.hpp"
 #include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 TEST_CASE("Lock-free allocator test", "[lockfree][allocator]")
 {
@@ -17,4 +20,82 @@ TEST_CASE("Lock-free allocator test", "[lockfree][allocator]")
 
     allocator.dealloc(last_ptr);
     REQUIRE(allocator.alloc() == last_ptr);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Lock-free allocator batch test", "[lockfree][allocator]")
+{
+    constexpr size_t TEST_SIZE = 6;
+    emblib::lockfree::allocator<uint64_t, TEST_SIZE> allocator;
+
+    uint64_t* ptrs[TEST_SIZE + 1];
+    REQUIRE(allocator.alloc_n({ptrs, 4}) == 4);
+    REQUIRE(allocator.get_allocation_count() == 4);
+    REQUIRE(allocator.alloc_n({ptrs + 4, 3}) == 2);
+    REQUIRE(allocator.alloc() == nullptr);
+
+    // All blocks are distinct
+    for (size_t i = 0; i < TEST_SIZE; i++) {
+        for (size_t j = i + 1; j < TEST_SIZE; j++) {
+            REQUIRE(ptrs[i] != ptrs[j]);
+        }
+    }
+
+    allocator.dealloc_n({ptrs, TEST_SIZE});
+    REQUIRE(allocator.get_allocation_count() == 0);
+    REQUIRE(allocator.alloc_n(ptrs) == TEST_SIZE);
+}
+
+TEST_CASE("Lock-free allocator magazine test", "[lockfree][allocator]")
+{
+    constexpr size_t TEST_SIZE = 8;
+    using allocator_t = emblib::lockfree::allocator<uint64_t, TEST_SIZE>;
+    allocator_t allocator;
+
+    {
+        allocator_t::magazine<4> magazine(allocator);
+
+        // Refilled in batches of half the magazine size
+        uint64_t* ptr = magazine.alloc();
+        REQUIRE(ptr != nullptr);
+        REQUIRE(allocator.get_allocation_count() == 2);
+
+        magazine.dealloc(ptr);
+        REQUIRE(magazine.alloc() == ptr);
+        magazine.dealloc(ptr);
+    }
+
+    // Cached blocks are returned when the magazine is destroyed
+    REQUIRE(allocator.get_allocation_count() == 0);
+}
+
+TEST_CASE("Lock-free allocator concurrent test", "[lockfree][allocator]")
+{
+    constexpr size_t TEST_SIZE = 16;
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t ITERATIONS = 10000;
+    emblib::lockfree::allocator<size_t, TEST_SIZE> allocator;
+    std::atomic<size_t> errors(0);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&allocator, &errors, t] {
+            for (size_t i = 0; i < ITERATIONS; i++) {
+                size_t* ptr = allocator.alloc();
+                if (ptr == nullptr)
+                    continue;
+                // Block must not be shared with other threads
+                *ptr = t;
+                std::this_thread::yield();
+                if (*ptr != t)
+                    errors++;
+                allocator.dealloc(ptr);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(errors == 0);
+    REQUIRE(allocator.get_allocation_count() == 0);
+}
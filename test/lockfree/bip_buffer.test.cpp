@@ -0,0 +1,87 @@
+#include "emblib/lockfree/bip_buffer.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <cstring>
+#include <thread>
+
+TEST_CASE("Lock-free bip buffer test", "[lockfree][bip_buffer]")
+{
+    constexpr size_t TEST_SIZE = 16;
+    emblib::lockfree::bip_buffer<TEST_SIZE> buffer;
+
+    REQUIRE(buffer.read().empty());
+    REQUIRE(buffer.reserve(TEST_SIZE + 1).empty());
+
+    // Commit less than reserved
+    auto region = buffer.reserve(14);
+    REQUIRE(region.size() == 14);
+    std::memset(region.data(), 1, 12);
+    buffer.commit(12);
+
+    auto data = buffer.read();
+    REQUIRE(data.size() == 12);
+    REQUIRE(data[11] == 1);
+    buffer.release(10);
+
+    // Not enough space at the end, region wraps to the start
+    region = buffer.reserve(6);
+    REQUIRE(region.size() == 6);
+    std::memset(region.data(), 2, 6);
+    buffer.commit(6);
+    REQUIRE(buffer.reserve(4).empty());
+
+    // Upper part is read first, then the wrapped part
+    data = buffer.read();
+    REQUIRE(data.size() == 2);
+    buffer.release(2);
+
+    data = buffer.read();
+    REQUIRE(data.size() == 6);
+    REQUIRE(data.data() == region.data());
+    REQUIRE(data[0] == 2);
+    buffer.release(6);
+    REQUIRE(buffer.read().empty());
+}
+
+TEST_CASE("Lock-free bip buffer variable length records", "[lockfree][bip_buffer]")
+{
+    constexpr size_t TEST_SIZE = 64;
+    constexpr size_t RECORD_COUNT = 10000;
+    emblib::lockfree::bip_buffer<TEST_SIZE> buffer;
+
+    // Records are a length byte followed by that many copies of the length
+    std::thread writer([&buffer] {
+        for (size_t i = 0; i < RECORD_COUNT;) {
+            const uint8_t length = static_cast<uint8_t>(1 + i % 20);
+            auto region = buffer.reserve(length + 1);
+            if (region.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::memset(region.data(), length, length + 1);
+            buffer.commit(length + 1);
+            i++;
+        }
+    });
+
+    for (size_t i = 0; i < RECORD_COUNT;) {
+        auto data = buffer.read();
+        if (data.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Records are never split, so a region holds whole records
+        size_t offset = 0;
+        while (offset < data.size()) {
+            const uint8_t length = data[offset];
+            REQUIRE(length == 1 + i % 20);
+            REQUIRE(offset + length + 1 <= data.size());
+            REQUIRE(data[offset + length] == length);
+            offset += length + 1;
+            i++;
+        }
+        buffer.release(offset);
+    }
+
+    writer.join();
+}
@@ -0,0 +1,57 @@
+#include "emblib/lockfree/blocking_queue.hpp"
+#include "emblib/lockfree/spmc_queue.hpp"
+#include "emblib/lockfree/spsc_queue.hpp"
+#include "emblib/lockfree/wait_strategy.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <thread>
+
+using emblib::io::timeout;
+
+TEST_CASE("Blocking queue test", "[lockfree][blocking_queue]")
+{
+    emblib::lockfree::blocking_queue<emblib::lockfree::spsc_queue<int, 2>, emblib::lockfree::spin_wait> queue;
+    int item;
+
+    REQUIRE(queue.push(1));
+    REQUIRE(queue.push(2));
+    REQUIRE_FALSE(queue.push(3));
+    REQUIRE((queue.pop_wait(item, timeout::min()) && item == 1));
+    REQUIRE((queue.pop_wait(item, timeout{1}) && item == 2));
+
+    REQUIRE_FALSE(queue.pop_wait(item, timeout::min()));
+    REQUIRE_FALSE(queue.pop_wait(item, timeout{1}));
+}
+
+TEST_CASE("Blocking queue wait for producer", "[lockfree][blocking_queue]")
+{
+    constexpr int ITEM_COUNT = 10000;
+    emblib::lockfree::blocking_queue<emblib::lockfree::spsc_queue<int, 16>, emblib::lockfree::yield_wait<>> queue;
+
+    std::thread producer([&queue] {
+        for (int i = 0; i < ITEM_COUNT;) {
+            i += queue.push(i);
+        }
+    });
+
+    int item;
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        REQUIRE((queue.pop_wait(item, timeout::max()) && item == i));
+    }
+    producer.join();
+}
+
+TEST_CASE("Blocking queue broadcast reader", "[lockfree][blocking_queue]")
+{
+    emblib::lockfree::blocking_queue<emblib::lockfree::spmc_queue<int, 4>, emblib::lockfree::yield_wait<>> queue;
+    auto reader = queue.get_queue().get_reader<true>();
+    int item;
+
+    REQUIRE_FALSE(queue.read_wait(reader, item, timeout{1}));
+
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        queue.push(7);
+    });
+    REQUIRE((queue.read_wait(reader, item, timeout::max()) && item == 7));
+    producer.join();
+}
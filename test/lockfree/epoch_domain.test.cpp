@@ -0,0 +1,126 @@
+#include "emblib/lockfree/epoch_domain.hpp"
+#include "emblib/lockfree/allocator.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Epoch domain test", "[lockfree][epoch_domain]")
+{
+    using domain_t = emblib::lockfree::epoch_domain<2, 4>;
+    domain_t domain;
+    emblib::lockfree::allocator<int, 8> allocator;
+
+    domain_t::participant writer(domain);
+    domain_t::participant reader(domain);
+    REQUIRE(writer.is_valid());
+    REQUIRE(reader.is_valid());
+    REQUIRE_FALSE(domain_t::participant(domain).is_valid());
+
+    int* node = allocator.alloc();
+    {
+        domain_t::guard read_guard(reader);
+        REQUIRE(writer.retire(allocator, node));
+
+        // Node can't be freed while the reader is pinned
+        const uint64_t epoch = domain.get_epoch();
+        for (size_t i = 0; i < 4; i++) {
+            writer.collect();
+        }
+        REQUIRE(allocator.get_allocation_count() == 1);
+        REQUIRE(domain.get_epoch() == epoch);
+    }
+
+    // Pinning doesn't advance the epoch
+    const uint64_t epoch = domain.get_epoch();
+    {
+        domain_t::guard read_guard(reader);
+    }
+    REQUIRE(domain.get_epoch() == epoch);
+
+    // Epoch advances in two steps once the reader left
+    for (size_t i = 0; i < 2; i++) {
+        writer.collect();
+    }
+    REQUIRE(allocator.get_allocation_count() == 0);
+}
+
+TEST_CASE("Epoch domain full retire list", "[lockfree][epoch_domain]")
+{
+    using domain_t = emblib::lockfree::epoch_domain<1, 2>;
+    emblib::lockfree::allocator<int, 8> allocator;
+
+    {
+        domain_t domain;
+        domain_t::participant self(domain);
+        {
+            // Epoch advances once past the pinned one, then the list of the next epoch fills up
+            domain_t::guard guard(self);
+            for (size_t i = 0; i < 3; i++) {
+                REQUIRE(self.retire(allocator, allocator.alloc()));
+            }
+            REQUIRE_FALSE(self.retire(allocator, allocator.alloc()));
+        }
+        REQUIRE(allocator.get_allocation_count() == 4);
+    }
+
+    // Domain frees the remaining nodes, the rejected one is still allocated
+    REQUIRE(allocator.get_allocation_count() == 1);
+}
+
+TEST_CASE("Epoch domain concurrent readers", "[lockfree][epoch_domain]")
+{
+    struct node_s {
+        uint64_t value;
+        uint64_t check;
+    };
+
+    constexpr size_t READER_COUNT = 3;
+    constexpr size_t UPDATE_COUNT = 20000;
+    using domain_t = emblib::lockfree::epoch_domain<READER_COUNT + 1, 16>;
+
+    domain_t domain;
+    emblib::lockfree::allocator<node_s, 64> allocator;
+    std::atomic<node_s*> current(new (allocator.alloc()) node_s{0, ~uint64_t(0)});
+    std::atomic<bool> done(false);
+    std::atomic<size_t> errors(0);
+
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < READER_COUNT; t++) {
+        readers.emplace_back([&] {
+            domain_t::participant self(domain);
+            while (!done.load()) {
+                domain_t::guard guard(self);
+                const node_s* node = current.load(std::memory_order_acquire);
+                const uint64_t value = node->value;
+                std::this_thread::yield();
+                // Node freed in the meantime is overwritten by the allocator and then reused
+                if (node->check != ~value)
+                    errors++;
+            }
+        });
+    }
+
+    {
+        domain_t::participant self(domain);
+        for (uint64_t i = 1; i <= UPDATE_COUNT;) {
+            domain_t::guard guard(self);
+            node_s* node = allocator.alloc();
+            if (node == nullptr) {
+                std::this_thread::yield();
+                continue;
+            }
+            new (node) node_s{i, ~i};
+
+            node_s* old = current.exchange(node, std::memory_order_acq_rel);
+            while (!self.retire(allocator, old)) {}
+            i++;
+        }
+    }
+    done = true;
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    REQUIRE(errors == 0);
+}
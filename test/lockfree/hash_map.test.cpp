@@ -0,0 +1,139 @@
+#include "emblib/lockfree/hash_map.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Lock-free hash map test", "[lockfree][hash_map]")
+{
+    emblib::lockfree::hash_map<uint16_t, uint32_t, 4> map;
+    uint32_t value;
+
+    REQUIRE_FALSE(map.find(1, value));
+    REQUIRE(map.insert(1, 10));
+    REQUIRE(map.insert(2, 20));
+    REQUIRE((map.find(1, value) && value == 10));
+    REQUIRE((map.find(2, value) && value == 20));
+
+    // Insert assigns the value of an existing key
+    REQUIRE(map.insert(1, 11));
+    REQUIRE((map.find(1, value) && value == 11));
+
+    REQUIRE(map.erase(1));
+    REQUIRE_FALSE(map.erase(1));
+    REQUIRE_FALSE(map.contains(1));
+    REQUIRE(map.contains(2));
+
+    // Erased key keeps its bucket, so only two new keys fit
+    REQUIRE(map.insert(3, 30));
+    REQUIRE(map.insert(4, 40));
+    REQUIRE_FALSE(map.insert(5, 50));
+    REQUIRE(map.insert(1, 12));
+    REQUIRE((map.find(1, value) && value == 12));
+
+    // Reserved key
+    REQUIRE_FALSE(map.insert(UINT16_MAX, 0));
+    REQUIRE_FALSE(map.contains(UINT16_MAX));
+}
+
+TEST_CASE("Lock-free hash map concurrent inserts", "[lockfree][hash_map]")
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t KEY_COUNT = 1000;
+    emblib::lockfree::hash_map<uint32_t, uint32_t, 1024> map;
+
+    // Every thread inserts all the keys, each key must end up in a single bucket
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&map] {
+            for (uint32_t key = 0; key < KEY_COUNT; key++) {
+                map.insert(key, key * 2);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    uint32_t value;
+    for (uint32_t key = 0; key < KEY_COUNT; key++) {
+        REQUIRE((map.find(key, value) && value == key * 2));
+    }
+    for (uint32_t key = KEY_COUNT; key < 1024; key++) {
+        REQUIRE(map.insert(key, 0));
+    }
+    REQUIRE_FALSE(map.insert(1024, 0));
+}
+
+TEST_CASE("Lock-free hash map readers and writer", "[lockfree][hash_map]")
+{
+    constexpr size_t READER_COUNT = 3;
+    constexpr uint16_t KEY_COUNT = 64;
+    emblib::lockfree::hash_map<uint16_t, uint32_t, 128> map;
+    std::atomic<bool> done(false);
+    std::atomic<size_t> errors(0);
+
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < READER_COUNT; t++) {
+        readers.emplace_back([&] {
+            uint32_t value;
+            while (!done.load()) {
+                for (uint16_t key = 0; key < KEY_COUNT; key++) {
+                    // Values of a key are always a multiple of it
+                    if (map.find(key, value) && value % (key + 1) != 0)
+                        errors++;
+                }
+            }
+        });
+    }
+
+    for (uint32_t round = 0; round < 2000; round++) {
+        for (uint16_t key = 0; key < KEY_COUNT; key++) {
+            if ((key + round) % 3 == 0)
+                map.erase(key);
+            else
+                map.insert(key, (key + 1) * round);
+        }
+    }
+    done = true;
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    REQUIRE(errors == 0);
+}
+
+TEST_CASE("Lock-free hash map updates of a present key", "[lockfree][hash_map]")
+{
+    struct payload_s {
+        uint32_t value;
+        uint32_t check;
+    };
+
+    constexpr size_t UPDATE_COUNT = 2000;
+    static payload_s payloads[UPDATE_COUNT];
+    emblib::lockfree::hash_map<uint16_t, payload_s*, 4> map;
+    std::atomic<bool> done(false);
+    std::atomic<size_t> errors(0);
+
+    payloads[0] = {0, ~0u};
+    REQUIRE(map.insert(1, &payloads[0]));
+
+    std::thread reader([&] {
+        payload_s* payload;
+        while (!done.load()) {
+            // Payload written before the update must be visible with the new value
+            if (map.find(1, payload) && payload->check != ~payload->value)
+                errors++;
+        }
+    });
+
+    for (uint32_t i = 1; i < UPDATE_COUNT; i++) {
+        payloads[i] = {i, ~i};
+        map.insert(1, &payloads[i]);
+    }
+    done = true;
+    reader.join();
+
+    REQUIRE(errors == 0);
+}
@@ -0,0 +1,70 @@
+#include "emblib/lockfree/mpmc_queue.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Lock-free MPMC queue test", "[lockfree][mpmc_queue]")
+{
+    struct message {
+        size_t value;
+    };
+
+    constexpr size_t TEST_SIZE = 4;
+    emblib::lockfree::mpmc_queue<message, TEST_SIZE> queue;
+
+    for (size_t i = 0; i < TEST_SIZE; i++) {
+        REQUIRE(queue.push(message {i}));
+    }
+    REQUIRE_FALSE(queue.push(message {0}));
+
+    for (size_t i = 0; i < TEST_SIZE; i++) {
+        message msg;
+        REQUIRE((queue.pop(msg) && msg.value == i));
+    }
+
+    message tmp;
+    REQUIRE_FALSE(queue.pop(tmp));
+}
+
+TEST_CASE("Lock-free MPMC queue multiple producers and consumers", "[lockfree][mpmc_queue]")
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t ITEM_COUNT = 10000;
+    emblib::lockfree::mpmc_queue<size_t, 16> queue;
+
+    std::atomic<size_t> received_count{0};
+    std::atomic<size_t> received_sum{0};
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&queue] {
+            for (size_t i = 1; i <= ITEM_COUNT;) {
+                if (queue.push(i)) {
+                    i++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            size_t value;
+            while (received_count.load() < THREAD_COUNT * ITEM_COUNT) {
+                if (queue.pop(value)) {
+                    received_sum += value;
+                    received_count++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every item must be received exactly once
+    REQUIRE(received_count == THREAD_COUNT * ITEM_COUNT);
+    REQUIRE(received_sum == THREAD_COUNT * ITEM_COUNT * (ITEM_COUNT + 1) / 2);
+}
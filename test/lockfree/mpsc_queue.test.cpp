@@ -0,0 +1,65 @@
+#include "emblib/lockfree/mpsc_queue.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <thread>
+#include <vector>
+
+TEST_CASE("Lock-free MPSC queue test", "[lockfree][mpsc_queue]")
+{
+    struct message {
+        size_t value;
+    };
+
+    constexpr size_t TEST_SIZE = 4;
+    emblib::lockfree::mpsc_queue<message, TEST_SIZE> queue;
+
+    for (size_t i = 0; i < TEST_SIZE; i++) {
+        REQUIRE(queue.push(message {i}));
+    }
+    REQUIRE_FALSE(queue.push(message {0}));
+
+    for (size_t i = 0; i < TEST_SIZE; i++) {
+        message msg;
+        REQUIRE((queue.pop(msg) && msg.value == i));
+    }
+
+    message tmp;
+    REQUIRE_FALSE(queue.pop(tmp));
+}
+
+TEST_CASE("Lock-free MPSC queue multiple producers", "[lockfree][mpsc_queue]")
+{
+    constexpr size_t PRODUCER_COUNT = 4;
+    constexpr size_t ITEM_COUNT = 10000;
+    emblib::lockfree::mpsc_queue<size_t, 16> queue;
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < PRODUCER_COUNT; p++) {
+        producers.emplace_back([&queue, p] {
+            for (size_t i = 0; i < ITEM_COUNT;) {
+                if (queue.push(p * ITEM_COUNT + i)) {
+                    i++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Items from each producer must arrive in order
+    size_t next[PRODUCER_COUNT] = {};
+    for (size_t received = 0; received < PRODUCER_COUNT * ITEM_COUNT;) {
+        size_t value;
+        if (!queue.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const size_t producer = value / ITEM_COUNT;
+        REQUIRE(value % ITEM_COUNT == next[producer]);
+        next[producer]++;
+        received++;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
@@ -0,0 +1,84 @@
+#include "emblib/lockfree/object_pool.hpp"
+#include "emblib/lockfree/spsc_queue.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+namespace {
+
+struct payload {
+    size_t length;
+    uint8_t data[1024];
+};
+
+}
+
+TEST_CASE("Object pool unique handle", "[lockfree][object_pool]")
+{
+    constexpr size_t TEST_SIZE = 2;
+    emblib::lockfree::object_pool<payload, TEST_SIZE> pool;
+
+    {
+        auto first = pool.make_unique(payload {3, {}});
+        auto second = pool.make_unique();
+        REQUIRE((first && second));
+        REQUIRE(first->length == 3);
+        REQUIRE_FALSE(pool.make_unique());
+
+        auto moved = std::move(first);
+        REQUIRE_FALSE(first);
+        REQUIRE(pool.get_allocation_count() == 2);
+
+        moved.reset();
+        REQUIRE(pool.get_allocation_count() == 1);
+    }
+
+    REQUIRE(pool.get_allocation_count() == 0);
+}
+
+TEST_CASE("Object pool shared handle", "[lockfree][object_pool]")
+{
+    constexpr size_t TEST_SIZE = 2;
+    emblib::lockfree::object_pool<payload, TEST_SIZE> pool;
+
+    auto handle = pool.make_shared(payload {5, {}});
+    REQUIRE(handle.get_use_count() == 1);
+
+    {
+        auto copy = handle;
+        REQUIRE(handle.get_use_count() == 2);
+        REQUIRE(copy.get() == handle.get());
+    }
+    REQUIRE(handle.get_use_count() == 1);
+
+    handle.reset();
+    REQUIRE(pool.get_allocation_count() == 0);
+}
+
+TEST_CASE("Object pool handles through a queue", "[lockfree][object_pool]")
+{
+    constexpr size_t TEST_SIZE = 2;
+    emblib::lockfree::object_pool<payload, TEST_SIZE> pool;
+    emblib::lockfree::spsc_queue<payload*, TEST_SIZE> queue_a;
+    emblib::lockfree::spsc_queue<payload*, TEST_SIZE> queue_b;
+
+    {
+        // Each consumer gets its own reference
+        auto handle = pool.make_shared(payload {7, {}});
+        auto copy_a = handle;
+        auto copy_b = handle;
+        REQUIRE(queue_a.push(copy_a.release()));
+        REQUIRE(queue_b.push(copy_b.release()));
+        REQUIRE(handle.get_use_count() == 3);
+    }
+
+    payload* ptr;
+    REQUIRE(queue_a.pop(ptr));
+    {
+        auto handle = pool.adopt_shared(ptr);
+        REQUIRE(handle->length == 7);
+    }
+    REQUIRE(pool.get_allocation_count() == 1);
+
+    REQUIRE(queue_b.pop(ptr));
+    pool.adopt_shared(ptr);
+    REQUIRE(pool.get_allocation_count() == 0);
+}
@@ -0,0 +1,78 @@
+#include "emblib/lockfree/seqlock_cell.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct sample {
+    size_t values[8];
+    size_t timestamp;
+};
+
+}
+
+TEST_CASE("Lock-free seqlock cell test", "[lockfree][seqlock_cell]")
+{
+    emblib::lockfree::seqlock_cell<int> cell(-1);
+
+    REQUIRE(cell.read() == -1);
+    REQUIRE(cell.get_write_count() == 0);
+
+    cell.write(1);
+    cell.write(2);
+    REQUIRE(cell.read() == 2);
+    REQUIRE(cell.get_write_count() == 2);
+
+    int value;
+    REQUIRE((cell.try_read(value) && value == 2));
+
+    // Readers retry while the value is modified in place
+    cell.begin_write();
+    cell.get() += 1;
+    REQUIRE_FALSE(cell.try_read(value));
+    cell.end_write();
+    REQUIRE(cell.read() == 3);
+    REQUIRE(cell.get_write_count() == 3);
+}
+
+TEST_CASE("Lock-free seqlock cell concurrent test", "[lockfree][seqlock_cell]")
+{
+    constexpr size_t WRITE_COUNT = 100000;
+    constexpr size_t READER_COUNT = 3;
+    emblib::lockfree::seqlock_cell<sample> cell(sample {});
+    std::atomic<size_t> errors(0);
+
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < READER_COUNT; r++) {
+        readers.emplace_back([&cell, &errors] {
+            // Snapshots are never torn and never go back in time
+            size_t last = 0;
+            while (last < WRITE_COUNT) {
+                const sample value = cell.read();
+                for (auto element : value.values) {
+                    if (element != value.timestamp)
+                        errors++;
+                }
+                if (value.timestamp < last)
+                    errors++;
+                last = value.timestamp;
+            }
+        });
+    }
+
+    for (size_t i = 1; i <= WRITE_COUNT; i++) {
+        sample value;
+        for (auto& element : value.values) {
+            element = i;
+        }
+        value.timestamp = i;
+        cell.write(value);
+    }
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    REQUIRE(errors == 0);
+}
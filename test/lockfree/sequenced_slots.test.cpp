@@ -0,0 +1,30 @@
+#include "emblib/lockfree/mpmc_queue.hpp"
+#include "emblib/lockfree/mpsc_queue.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+
+namespace {
+
+using mpsc_queue_t = emblib::lockfree::mpsc_queue<int, 2>;
+using mpmc_queue_t = emblib::lockfree::mpmc_queue<int, 2>;
+
+}
+
+TEMPLATE_TEST_CASE("Lock-free sequenced slots smallest capacity", "[lockfree][mpsc_queue][mpmc_queue]",
+                   mpsc_queue_t, mpmc_queue_t)
+{
+    TestType queue;
+    int item = 0;
+
+    // Slots are reused many times, a full queue never overwrites an item
+    for (int i = 0; i < 10; i++) {
+        REQUIRE(queue.push(2 * i));
+        REQUIRE(queue.push(2 * i + 1));
+        REQUIRE_FALSE(queue.push(-1));
+
+        REQUIRE((queue.pop(item) && item == 2 * i));
+        REQUIRE(queue.push(2 * i + 2));
+        REQUIRE((queue.pop(item) && item == 2 * i + 1));
+        REQUIRE((queue.pop(item) && item == 2 * i + 2));
+        REQUIRE_FALSE(queue.pop(item));
+    }
+}
@@ -0,0 +1,62 @@
+#include "emblib/lockfree/slab_allocator.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <vector>
+
+using test_slab_t = emblib::lockfree::slab_allocator<
+    emblib::lockfree::slab_class_s<64, 2>,
+    emblib::lockfree::slab_class_s<256, 1>,
+    emblib::lockfree::slab_class_s<1024, 1>
+>;
+
+TEST_CASE("Slab allocator test", "[lockfree][slab_allocator]")
+{
+    test_slab_t slab;
+
+    REQUIRE(slab.get_class_count() == 3);
+    REQUIRE(slab.get_max_size() == 1024);
+    REQUIRE(slab.alloc(0).empty());
+    REQUIRE(slab.alloc(2000).empty());
+
+    auto small = slab.alloc(10);
+    REQUIRE(small.size() == 10);
+    REQUIRE(slab.get_usage(0).allocated == 1);
+
+    auto medium = slab.alloc(200);
+    REQUIRE(medium.size() == 200);
+    REQUIRE(slab.get_usage(1).allocated == 1);
+
+    // Falls back to a larger class once the matching one is exhausted
+    auto fallback = slab.alloc(100);
+    REQUIRE(fallback.size() == 100);
+    REQUIRE(slab.get_usage(2).allocated == 1);
+    REQUIRE(slab.alloc(100).empty());
+
+    slab.dealloc(small.data());
+    slab.dealloc(medium.data());
+    slab.dealloc(fallback.data());
+
+    for (size_t i = 0; i < slab.get_class_count(); i++) {
+        auto usage = slab.get_usage(i);
+        REQUIRE(usage.allocated == 0);
+        REQUIRE(usage.capacity > 0);
+    }
+    REQUIRE(slab.get_usage(1).block_size == 256);
+}
+
+TEST_CASE("Slab allocator standard adapter", "[lockfree][slab_allocator]")
+{
+    test_slab_t slab;
+    emblib::lockfree::slab_std_allocator<uint32_t, test_slab_t> allocator(slab);
+
+    {
+        std::vector<uint32_t, decltype(allocator)> values(allocator);
+        values.reserve(50);
+        for (uint32_t i = 0; i < 50; i++) {
+            values.push_back(i);
+        }
+        REQUIRE(values[49] == 49);
+        REQUIRE(slab.get_usage(1).allocated == 1);
+    }
+
+    REQUIRE(slab.get_usage(1).allocated == 0);
+}
@@ -1,5 +1,6 @@
 #include "emblib/lockfree/spmc_queue.hpp"
 #include "catch2/catch_test_macros.hpp"
+#include <thread>
 
 TEST_CASE("Lock-free SPMC queue test", "[lockfree][spmc_queue]")
 {
@@ -40,4 +41,62 @@ TEST_CASE("Lock-free SPMC queue test", "[lockfree][spmc_queue]")
     }
     
     REQUIRE(reader.has_overflowed());
-}
\ No newline at end of file
+}
+
+TEST_CASE("Lock-free SPMC queue overflow resync", "[lockfree][spmc_queue]")
+{
+    constexpr size_t TEST_SIZE = 4;
+    emblib::lockfree::spmc_queue<size_t, TEST_SIZE> queue;
+    auto reader = queue.get_reader<true>();
+
+    for (size_t i = 0; i < 2 * TEST_SIZE + 1; i++) {
+        queue.push(i);
+    }
+    REQUIRE(reader.has_overflowed());
+
+    // Reader skips to the oldest item still in the queue
+    size_t value;
+    size_t skip_count;
+    REQUIRE(reader.read(value, skip_count));
+    REQUIRE(skip_count == TEST_SIZE + 1);
+    REQUIRE(value == TEST_SIZE + 1);
+    REQUIRE_FALSE(reader.has_overflowed());
+
+    for (size_t i = TEST_SIZE + 2; i < 2 * TEST_SIZE + 1; i++) {
+        REQUIRE((reader.read(value, skip_count) && value == i && skip_count == 0));
+    }
+    REQUIRE_FALSE(reader.read(value));
+}
+
+TEST_CASE("Lock-free SPMC queue concurrent reader", "[lockfree][spmc_queue]")
+{
+    struct message {
+        size_t value;
+        size_t check;
+    };
+
+    constexpr size_t TEST_SIZE = 4;
+    constexpr size_t ITEM_COUNT = 100000;
+    emblib::lockfree::spmc_queue<message, TEST_SIZE> queue;
+    auto reader = queue.get_reader<true>();
+
+    std::thread producer([&queue] {
+        for (size_t i = 0; i < ITEM_COUNT; i++) {
+            queue.push(message {i, ~i});
+        }
+    });
+
+    // Every item read must be complete and in order, counting skipped ones
+    size_t next = 0;
+    while (next < ITEM_COUNT) {
+        message msg;
+        size_t skip_count;
+        if (!reader.read(msg, skip_count))
+            continue;
+        REQUIRE(msg.check == ~msg.value);
+        REQUIRE(msg.value == next + skip_count);
+        next = msg.value + 1;
+    }
+
+    producer.join();
+}
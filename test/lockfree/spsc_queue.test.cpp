@@ -25,4 +25,77 @@ TEST_CASE("Lock-free SPSC queue test", "[lockfree][spsc_queue]")
     message tmp;
     REQUIRE(!queue.pop(tmp));
 
-}
\ No newline at end of file
+}
+
+TEST_CASE("Lock-free SPSC queue batch test", "[lockfree][spsc_queue]")
+{
+    constexpr size_t TEST_SIZE = 5;
+    emblib::lockfree::spsc_queue<int, TEST_SIZE> queue;
+
+    const int input[] = {0, 1, 2, 3, 4, 5, 6};
+    int output[TEST_SIZE] = {};
+
+    REQUIRE(queue.push_n({input, 3}) == 3);
+    REQUIRE(queue.pop_n({output, 2}) == 2);
+    REQUIRE((output[0] == 0 && output[1] == 1));
+
+    // Tail wraps around the end of the buffer
+    REQUIRE(queue.push_n(input) == TEST_SIZE - 1);
+    REQUIRE(queue.push_n(input) == 0);
+
+    REQUIRE(queue.pop_n(output) == TEST_SIZE);
+    REQUIRE(output[0] == 2);
+    for (size_t i = 1; i < TEST_SIZE; i++) {
+        REQUIRE(output[i] == static_cast<int>(i - 1));
+    }
+    REQUIRE(queue.pop_n(output) == 0);
+}
+
+TEST_CASE("Lock-free SPSC queue in-place test", "[lockfree][spsc_queue]")
+{
+    struct frame {
+        uint8_t data[16];
+        size_t length;
+    };
+
+    constexpr size_t TEST_SIZE = 3;
+    emblib::lockfree::spsc_queue<frame, TEST_SIZE> queue;
+
+    REQUIRE(queue.peek().empty());
+
+    auto slots = queue.reserve(2);
+    REQUIRE(slots.size() == 2);
+    slots[0].length = 1;
+    slots[1].length = 2;
+
+    // Nothing is visible until committed
+    REQUIRE(queue.peek().empty());
+    queue.commit(1);
+
+    auto items = queue.peek();
+    REQUIRE((items.size() == 1 && items[0].length == 1));
+
+    queue.commit(1);
+    items = queue.peek();
+    REQUIRE((items.size() == 2 && items[1].length == 2));
+    queue.release(2);
+
+    // Range of free slots wraps around the end of the buffer
+    slots = queue.reserve();
+    REQUIRE(slots.size() == TEST_SIZE);
+    REQUIRE(slots.second.size() == 1);
+    for (size_t i = 0; i < slots.size(); i++) {
+        slots[i].length = 10 + i;
+    }
+    queue.commit(slots.size());
+    REQUIRE(queue.reserve().empty());
+
+    items = queue.peek();
+    REQUIRE(items.size() == TEST_SIZE);
+    REQUIRE(items.second.size() == 1);
+    for (size_t i = 0; i < items.size(); i++) {
+        REQUIRE(items[i].length == 10 + i);
+    }
+    queue.release(items.size());
+    REQUIRE(queue.peek().empty());
+}
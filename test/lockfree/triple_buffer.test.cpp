@@ -0,0 +1,62 @@
+#include "emblib/lockfree/triple_buffer.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <thread>
+
+namespace {
+
+struct sample {
+    size_t values[8];
+    size_t timestamp;
+};
+
+}
+
+TEST_CASE("Lock-free triple buffer test", "[lockfree][triple_buffer]")
+{
+    emblib::lockfree::triple_buffer<int> buffer(-1);
+
+    REQUIRE_FALSE(buffer.has_update());
+    REQUIRE(buffer.read() == -1);
+
+    // Only the latest value is kept
+    buffer.write(1);
+    buffer.write(2);
+    REQUIRE(buffer.has_update());
+    REQUIRE(buffer.read() == 2);
+    REQUIRE_FALSE(buffer.has_update());
+    REQUIRE(buffer.read() == 2);
+
+    buffer.get_back() = 3;
+    buffer.publish();
+    REQUIRE(buffer.read() == 3);
+}
+
+TEST_CASE("Lock-free triple buffer concurrent test", "[lockfree][triple_buffer]")
+{
+    constexpr size_t WRITE_COUNT = 100000;
+    emblib::lockfree::triple_buffer<sample> buffer;
+
+    std::thread writer([&buffer] {
+        for (size_t i = 1; i <= WRITE_COUNT; i++) {
+            auto& value = buffer.get_back();
+            for (auto& element : value.values) {
+                element = i;
+            }
+            value.timestamp = i;
+            buffer.publish();
+        }
+    });
+
+    // Snapshots are never torn and never go back in time
+    size_t last = 0;
+    while (last < WRITE_COUNT) {
+        const sample& value = buffer.read();
+        for (auto element : value.values) {
+            REQUIRE(element == value.timestamp);
+        }
+        REQUIRE(value.timestamp >= last);
+        last = value.timestamp;
+    }
+
+    writer.join();
+}
@@ -0,0 +1,79 @@
+#include "emblib/lockfree/work_stealing_deque.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Work stealing deque test", "[lockfree][work_stealing_deque]")
+{
+    constexpr size_t TEST_SIZE = 4;
+    emblib::lockfree::work_stealing_deque<size_t, TEST_SIZE> deque;
+    size_t item;
+
+    REQUIRE(deque.is_empty());
+    REQUIRE_FALSE(deque.pop(item));
+    REQUIRE_FALSE(deque.steal(item));
+
+    for (size_t i = 0; i < TEST_SIZE; i++) {
+        REQUIRE(deque.push(i));
+    }
+    REQUIRE_FALSE(deque.push(0));
+
+    // Owner pops the newest item, thieves steal the oldest
+    REQUIRE((deque.pop(item) && item == 3));
+    REQUIRE((deque.steal(item) && item == 0));
+    REQUIRE((deque.steal(item) && item == 1));
+    REQUIRE((deque.pop(item) && item == 2));
+
+    REQUIRE(deque.is_empty());
+    REQUIRE_FALSE(deque.pop(item));
+    REQUIRE_FALSE(deque.steal(item));
+}
+
+TEST_CASE("Work stealing deque concurrent thieves", "[lockfree][work_stealing_deque]")
+{
+    constexpr size_t THIEF_COUNT = 3;
+    constexpr size_t ITEM_COUNT = 100000;
+    emblib::lockfree::work_stealing_deque<size_t, 64> deque;
+
+    std::atomic<size_t> taken_count{0};
+    std::atomic<size_t> taken_sum{0};
+
+    std::vector<std::thread> thieves;
+    for (size_t t = 0; t < THIEF_COUNT; t++) {
+        thieves.emplace_back([&] {
+            size_t item;
+            while (taken_count.load() < ITEM_COUNT) {
+                if (deque.steal(item)) {
+                    taken_sum += item;
+                    taken_count++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Owner pushes all the items and pops some of them back
+    size_t item;
+    for (size_t i = 1; i <= ITEM_COUNT;) {
+        if (deque.push(i)) {
+            i++;
+        } else if (deque.pop(item)) {
+            taken_sum += item;
+            taken_count++;
+        }
+    }
+    while (deque.pop(item)) {
+        taken_sum += item;
+        taken_count++;
+    }
+
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    // Every item is taken exactly once
+    REQUIRE(taken_count == ITEM_COUNT);
+    REQUIRE(taken_sum == ITEM_COUNT * (ITEM_COUNT + 1) / 2);
+}
@@ -0,0 +1,90 @@
+#include "emblib/metrics/counters.hpp"
+#include "emblib/lockfree/allocator.hpp"
+#include "emblib/lockfree/spmc_queue.hpp"
+#include "emblib/lockfree/spsc_queue.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <thread>
+#include <vector>
+
+// Disabled metrics take no space in the library types
+static_assert(emblib::metrics::IS_ENABLED || std::is_empty_v<emblib::metrics::counters<4>>);
+
+TEST_CASE("Sharded counters test", "[metrics][counters]")
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t ADD_COUNT = 10000;
+    emblib::metrics::sharded_counters<2, 2> counters;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&counters] {
+            for (size_t i = 0; i < ADD_COUNT; i++) {
+                counters.add(0);
+                counters.add(1, 3);
+                counters.sub(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(counters.get(0) == THREAD_COUNT * ADD_COUNT);
+    REQUIRE(counters.get(1) == 2 * THREAD_COUNT * ADD_COUNT);
+}
+
+TEST_CASE("Gauge test", "[metrics][counters]")
+{
+    emblib::metrics::gauge gauge;
+
+    gauge.set(5);
+    gauge.set(2);
+    REQUIRE(gauge.get() == 2);
+    REQUIRE(gauge.get_max() == 5);
+}
+
+TEST_CASE("Library type metrics", "[metrics][counters]")
+{
+    emblib::lockfree::allocator<int, 2> allocator;
+    using allocator_t = decltype(allocator);
+
+    int* first = allocator.alloc();
+    allocator.alloc();
+    allocator.alloc();
+    allocator.dealloc(first);
+
+    emblib::lockfree::spsc_queue<int, 2> queue;
+    using queue_t = decltype(queue);
+    int item;
+
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+    queue.pop(item);
+
+    emblib::lockfree::spmc_queue<int, 2> broadcast;
+    using broadcast_t = decltype(broadcast);
+    auto reader = broadcast.get_reader<true>();
+
+    for (int i = 0; i < 4; i++) {
+        broadcast.push(i);
+    }
+    reader.read(item);
+
+    if constexpr (emblib::metrics::IS_ENABLED) {
+        REQUIRE(allocator.get_metrics().get(allocator_t::ALLOCATED) == 1);
+        REQUIRE(allocator.get_metrics().get(allocator_t::ALLOC_FAILED) == 1);
+
+        REQUIRE(queue.get_metrics().get(queue_t::PUSHED) == 2);
+        REQUIRE(queue.get_metrics().get(queue_t::POPPED) == 1);
+        REQUIRE(queue.get_metrics().get(queue_t::FULL) == 1);
+
+        REQUIRE(broadcast.get_metrics().get(broadcast_t::WRITTEN) == 4);
+        REQUIRE(broadcast.get_metrics().get(broadcast_t::READ) == 1);
+        REQUIRE(broadcast.get_metrics().get(broadcast_t::SKIPPED) == 2);
+    } else {
+        REQUIRE(allocator.get_metrics().get(allocator_t::ALLOCATED) == 0);
+        REQUIRE(queue.get_metrics().get(queue_t::PUSHED) == 0);
+        REQUIRE(broadcast.get_metrics().get(broadcast_t::WRITTEN) == 0);
+    }
+}
@@ -0,0 +1,83 @@
+#include "emblib/metrics/histogram.hpp"
+#include "emblib/metrics/registry.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <cstring>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Histogram buckets test", "[metrics][histogram]")
+{
+    using histogram_t = emblib::metrics::histogram<8>;
+
+    REQUIRE(histogram_t::get_bucket_index(0) == 0);
+    REQUIRE(histogram_t::get_bucket_index(1) == 1);
+    REQUIRE(histogram_t::get_bucket_index(2) == 2);
+    REQUIRE(histogram_t::get_bucket_index(3) == 2);
+    REQUIRE(histogram_t::get_bucket_index(64) == 7);
+    // Values past the range are counted in the last bucket
+    REQUIRE(histogram_t::get_bucket_index(1000) == 7);
+
+    histogram_t histogram;
+    REQUIRE(histogram.get_percentile(0.5) == 0);
+
+    for (uint64_t value = 0; value < 100; value++) {
+        histogram.record(value);
+    }
+    REQUIRE(histogram.get_count() == 100);
+    REQUIRE(histogram.get_max() == 99);
+    REQUIRE(histogram.get_bucket(0) == 1);
+    REQUIRE(histogram.get_bucket(7) == 36);
+
+    // Median is 50, reported as the upper bound of the [32, 64) bucket
+    REQUIRE(histogram.get_percentile(0.5) == 63);
+    // Last bucket is bounded only by the maximum
+    REQUIRE(histogram.get_percentile(0.99) == 99);
+    REQUIRE(histogram.get_percentile(0.1) == 15);
+}
+
+TEST_CASE("Histogram concurrent record test", "[metrics][histogram]")
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t RECORD_COUNT = 10000;
+    emblib::metrics::histogram<> histogram;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&histogram, t] {
+            for (size_t i = 0; i < RECORD_COUNT; i++) {
+                histogram.record(i * THREAD_COUNT + t);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(histogram.get_count() == THREAD_COUNT * RECORD_COUNT);
+    REQUIRE(histogram.get_max() == THREAD_COUNT * RECORD_COUNT - 1);
+}
+
+TEST_CASE("Histogram registry test", "[metrics][histogram]")
+{
+    using emblib::metrics::registry;
+    using emblib::metrics::sample_s;
+
+    emblib::metrics::histogram<> histogram;
+    histogram.record(5);
+    histogram.record(100);
+
+    sample_s samples[8];
+    auto registration = registry::add("latency", histogram);
+    REQUIRE(registration.is_valid());
+    REQUIRE(registry::snapshot(samples) == 4);
+    REQUIRE(std::strcmp(samples[0].value_name, "count") == 0);
+    REQUIRE(samples[0].value == 2);
+    REQUIRE(samples[1].value == 7);
+    REQUIRE(samples[2].value == 100);
+    REQUIRE(std::strcmp(samples[3].value_name, "max") == 0);
+    REQUIRE(samples[3].value == 100);
+
+    // Histograms of disabled profiling are not registered
+    emblib::metrics::null_histogram<> null_histogram;
+    REQUIRE_FALSE(registry::add("disabled", null_histogram).is_valid());
+}
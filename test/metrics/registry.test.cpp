@@ -0,0 +1,90 @@
+#include "emblib/metrics/registry.hpp"
+#include "emblib/lockfree/allocator.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+TEST_CASE("Metrics registry test", "[metrics][registry]")
+{
+    using emblib::metrics::registry;
+    using emblib::metrics::sample_s;
+
+    static constexpr const char* NAMES[] = {"sent", "dropped"};
+    emblib::metrics::sharded_counters<2> counters;
+    emblib::metrics::gauge depth;
+
+    counters.add(0, 10);
+    counters.add(1);
+    depth.set(3);
+
+    sample_s samples[8];
+    {
+        auto counters_registration = registry::add("link", counters, NAMES);
+        auto depth_registration = registry::add("depth", depth);
+        REQUIRE(counters_registration.is_valid());
+        REQUIRE(depth_registration.is_valid());
+
+        REQUIRE(registry::snapshot(samples) == 4);
+        REQUIRE(std::strcmp(samples[0].name, "link") == 0);
+        REQUIRE(std::strcmp(samples[0].value_name, "sent") == 0);
+        REQUIRE(samples[0].value == 10);
+        REQUIRE(samples[1].value == 1);
+        REQUIRE(std::strcmp(samples[2].name, "depth") == 0);
+        REQUIRE(samples[2].value == 3);
+        REQUIRE(std::strcmp(samples[3].value_name, "max") == 0);
+
+        // Entries which don't fit in the span are skipped
+        REQUIRE(registry::snapshot({samples, 3}) == 2);
+
+        counters_registration.reset();
+        REQUIRE(registry::snapshot(samples) == 2);
+    }
+    REQUIRE(registry::snapshot(samples) == 0);
+
+    // Library types are only registered if metrics are enabled
+    emblib::lockfree::allocator<int, 4> allocator;
+    allocator.alloc();
+    auto allocator_registration = registry::add("pool", allocator);
+    REQUIRE(allocator_registration.is_valid() == emblib::metrics::IS_ENABLED);
+
+    if constexpr (emblib::metrics::IS_ENABLED) {
+        REQUIRE(registry::snapshot(samples) == 2);
+        REQUIRE(std::strcmp(samples[0].value_name, "allocated") == 0);
+        REQUIRE(samples[0].value == 1);
+    }
+}
+
+TEST_CASE("Metrics registry removal during snapshot", "[metrics][registry]")
+{
+    using emblib::metrics::registry;
+    using emblib::metrics::sample_s;
+
+    std::atomic<bool> done{false};
+    std::atomic<size_t> invalid_count{0};
+    std::thread reader([&] {
+        sample_s samples[8];
+        while (!done.load()) {
+            const size_t count = registry::snapshot(samples);
+            for (size_t i = 0; i < count; i++) {
+                if (samples[i].value != 5)
+                    invalid_count++;
+            }
+        }
+    });
+
+    // Source is destroyed right after its registration
+    for (int i = 0; i < 1000; i++) {
+        auto depth = std::make_unique<emblib::metrics::gauge>();
+        depth->set(5);
+        auto registration = registry::add("depth", *depth);
+        REQUIRE(registration.is_valid());
+        registration.reset();
+        depth->set(-1);
+    }
+
+    done.store(true);
+    reader.join();
+    REQUIRE(invalid_count.load() == 0);
+}
@@ -0,0 +1,113 @@
+#include "emblib/rtos/cyclic_executive.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <chrono>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * Clock which only moves when tasks consume time or the executive sleeps
+ */
+class fake_clock : public emblib::rtos::clock {
+public:
+    std::chrono::nanoseconds now() const noexcept override
+    {
+        return m_now;
+    }
+
+    void sleep_until(std::chrono::nanoseconds time) noexcept override
+    {
+        m_now = std::max(m_now, time);
+    }
+
+    void consume(std::chrono::nanoseconds duration) noexcept
+    {
+        m_now += duration;
+    }
+
+private:
+    std::chrono::nanoseconds m_now{1s};
+};
+
+using executive_t = emblib::rtos::cyclic_executive<4>;
+using stats_t = executive_t::task_stats;
+
+}
+
+TEST_CASE("Cyclic executive rate-monotonic order", "[rtos][cyclic_executive]")
+{
+    fake_clock clock;
+    executive_t executive(clock);
+    std::vector<char> trace;
+
+    auto slow = [&] { trace.push_back('s'); };
+    auto fast = [&] {
+        trace.push_back('f');
+        if (trace.size() >= 8)
+            executive.stop();
+    };
+
+    REQUIRE(executive.add_task(slow, 4ms) == 0);
+    REQUIRE(executive.add_task(fast, 1ms) == 1);
+    REQUIRE(executive.add_task(fast, 0ms) == executive_t::NO_TASK);
+    executive.run();
+
+    // Shorter period runs first when both are released
+    REQUIRE(trace == std::vector<char>{'f', 's', 'f', 'f', 'f', 'f', 's', 'f'});
+    REQUIRE(clock.now() == 1s + 5ms);
+
+    REQUIRE(executive.get_task_stats(1).get_metrics().get(stats_t::RUNS) == 6);
+    REQUIRE(executive.get_task_stats(0).get_metrics().get(stats_t::RUNS) == 2);
+    REQUIRE(executive.get_task_stats(1).get_metrics().get(stats_t::DEADLINE_MISSES) == 0);
+}
+
+TEST_CASE("Cyclic executive priority", "[rtos][cyclic_executive]")
+{
+    fake_clock clock;
+    executive_t executive(clock);
+    std::vector<char> trace;
+
+    auto low = [&] { trace.push_back('l'); };
+    auto high = [&] {
+        trace.push_back('h');
+        executive.stop();
+    };
+
+    executive.add_task(low, 1ms);
+    executive.add_task(high, 10ms, 1);
+    executive.run();
+
+    REQUIRE(trace == std::vector<char>{'h'});
+}
+
+TEST_CASE("Cyclic executive statistics", "[rtos][cyclic_executive]")
+{
+    fake_clock clock;
+    executive_t executive(clock);
+    size_t runs = 0;
+
+    auto blocker = [&] { clock.consume(300us); };
+    auto task = [&] {
+        // Third job overruns by more than two periods
+        clock.consume(runs == 2 ? 2500us : 100us);
+        if (++runs == 5)
+            executive.stop();
+    };
+
+    executive.add_task(blocker, 10ms, 1);
+    const size_t index = executive.add_task(task, 1ms);
+    executive.run();
+
+    const stats_t& stats = executive.get_task_stats(index);
+    REQUIRE(stats.get_metrics().get(stats_t::RUNS) == 5);
+    // Late job and the skipped release
+    REQUIRE(stats.get_metrics().get(stats_t::DEADLINE_MISSES) == 2);
+    REQUIRE(stats.get_execution_time().get() == 100'000);
+    REQUIRE(stats.get_execution_time().get_max() == 2'500'000);
+    // First job waits for the higher priority task, and the job
+    // after the overrun starts late on the release it catches up to
+    REQUIRE(stats.get_jitter().get() == 0);
+    REQUIRE(stats.get_jitter().get_max() == 500'000);
+}
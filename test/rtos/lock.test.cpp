@@ -0,0 +1,114 @@
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/mcs_lock.hpp"
+#include "emblib/rtos/rw_spinlock.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "emblib/rtos/ticket_lock.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Scoped lock backs off if a lock is taken", "[rtos][lock]")
+{
+    emblib::rtos::spinlock s1, s2;
+    bool has_locked = false;
+
+    s2.lock();
+    std::thread thread([&] {
+        emblib::rtos::scoped_lock lock(s1, s2);
+        has_locked = true;
+    });
+
+    // First lock must be released while waiting for the second
+    while (!s1.try_lock()) {
+        std::this_thread::yield();
+    }
+    s1.unlock();
+    s2.unlock();
+    thread.join();
+    REQUIRE(has_locked);
+}
+
+TEST_CASE("Scoped lock in opposite orders", "[rtos][lock]")
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t INCREMENT_COUNT = 10000;
+
+    emblib::rtos::spinlock s1, s2;
+    emblib::rtos::rw_spinlock rw;
+    size_t counter = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < THREAD_COUNT; i++) {
+        threads.emplace_back([&, i] {
+            for (size_t j = 0; j < INCREMENT_COUNT; j++) {
+                if (i % 2 == 0) {
+                    emblib::rtos::scoped_lock lock(s1, rw, s2);
+                    counter++;
+                } else {
+                    emblib::rtos::scoped_lock lock(s2, rw, s1);
+                    counter++;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(counter == THREAD_COUNT * INCREMENT_COUNT);
+}
+
+TEMPLATE_TEST_CASE("Lock mutual exclusion", "[rtos][lock]",
+                   emblib::rtos::spinlock, emblib::rtos::ticket_lock, emblib::rtos::mcs_lock)
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t INCREMENT_COUNT = 10000;
+
+    TestType l;
+    size_t counter = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&l, &counter] {
+            for (size_t i = 0; i < INCREMENT_COUNT; i++) {
+                std::lock_guard lock(l);
+                counter++;
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(counter == THREAD_COUNT * INCREMENT_COUNT);
+}
+
+TEMPLATE_TEST_CASE("Fair lock hand-off order", "[rtos][lock]",
+                   emblib::rtos::ticket_lock, emblib::rtos::mcs_lock)
+{
+    constexpr size_t WAITER_COUNT = 4;
+
+    TestType l;
+    std::vector<size_t> order;
+    std::vector<std::thread> waiters;
+    order.reserve(WAITER_COUNT);
+
+    l.lock();
+    for (size_t w = 0; w < WAITER_COUNT; w++) {
+        waiters.emplace_back([&l, &order, w] {
+            std::lock_guard lock(l);
+            order.push_back(w);
+        });
+        // Waiter joins the queue before the next one is started
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    l.unlock();
+
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    REQUIRE(order == std::vector<size_t>{0, 1, 2, 3});
+}
@@ -0,0 +1,63 @@
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/mcs_lock.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("MCS lock", "[rtos][mcs_lock]")
+{
+    emblib::rtos::mcs_lock l;
+
+    REQUIRE(l.try_lock());
+    REQUIRE_FALSE(l.try_lock());
+
+    l.unlock();
+    l.lock();
+    REQUIRE_FALSE(l.try_lock());
+
+    l.unlock();
+    REQUIRE(l.try_lock());
+    l.unlock();
+}
+
+TEST_CASE("MCS lock scoped lock", "[rtos][mcs_lock]")
+{
+    emblib::rtos::mcs_lock l1, l2;
+
+    {
+        emblib::rtos::scoped_lock lock(l1, l2);
+
+        REQUIRE_FALSE(l1.try_lock());
+        REQUIRE_FALSE(l2.try_lock());
+    }
+
+    REQUIRE(l1.try_lock());
+    REQUIRE(l2.try_lock());
+    // Release in the same order as acquired
+    l1.unlock();
+    l2.unlock();
+}
+
+TEST_CASE("MCS lock caller supplied nodes", "[rtos][mcs_lock]")
+{
+    constexpr size_t LOCK_COUNT = emblib::rtos::mcs_lock::MAX_HELD_LOCKS + 2;
+
+    emblib::rtos::mcs_lock locks[LOCK_COUNT];
+    emblib::rtos::mcs_lock::node_s nodes[LOCK_COUNT];
+
+    // Caller supplied nodes don't count towards the pool limit
+    for (size_t i = 0; i < LOCK_COUNT; i++) {
+        locks[i].lock(nodes[i]);
+    }
+    for (size_t i = 0; i < LOCK_COUNT; i++) {
+        REQUIRE_FALSE(locks[i].try_lock());
+    }
+    for (size_t i = 0; i < LOCK_COUNT; i++) {
+        locks[i].unlock(nodes[i]);
+    }
+
+    emblib::rtos::mcs_lock::node_s node;
+    REQUIRE(locks[0].try_lock(node));
+    REQUIRE_FALSE(locks[0].try_lock());
+    locks[0].unlock(node);
+    REQUIRE(locks[0].try_lock());
+    locks[0].unlock();
+}
@@ -0,0 +1,78 @@
+#include "emblib/rtos/profiled_lock.hpp"
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/rw_spinlock.hpp"
+#include "emblib/rtos/spinlock.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Disabled profiling adds nothing to the lock
+static_assert(sizeof(emblib::rtos::profiled_lock<emblib::rtos::spinlock, false>) == sizeof(emblib::rtos::spinlock));
+
+TEST_CASE("Profiled lock test", "[rtos][profiled_lock]")
+{
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t LOCK_COUNT = 1000;
+    emblib::rtos::profiled_lock<emblib::rtos::spinlock, true> lock;
+    size_t counter = 0;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&lock, &counter] {
+            for (size_t i = 0; i < LOCK_COUNT; i++) {
+                emblib::rtos::scoped_lock guard(lock);
+                counter++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(counter == THREAD_COUNT * LOCK_COUNT);
+    REQUIRE(lock.get_wait_time().get_count() == THREAD_COUNT * LOCK_COUNT);
+    REQUIRE(lock.get_hold_time().get_count() == THREAD_COUNT * LOCK_COUNT);
+
+    // Successful try_lock doesn't wait
+    const uint64_t zero_waits = lock.get_wait_time().get_bucket(0);
+    REQUIRE(lock.try_lock());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    lock.unlock();
+    REQUIRE(lock.get_wait_time().get_bucket(0) == zero_waits + 1);
+    REQUIRE(lock.get_hold_time().get_max() >= 1'000'000);
+}
+
+TEST_CASE("Disabled profiled lock test", "[rtos][profiled_lock]")
+{
+    emblib::rtos::profiled_lock<emblib::rtos::spinlock, false> lock;
+    {
+        emblib::rtos::scoped_lock guard(lock);
+        REQUIRE_FALSE(lock.try_lock());
+    }
+    REQUIRE(lock.try_lock());
+    lock.unlock();
+
+    REQUIRE(lock.get_wait_time().get_count() == 0);
+    REQUIRE(lock.get_hold_time().get_count() == 0);
+}
+
+TEST_CASE("Profiled read-write lock test", "[rtos][profiled_lock]")
+{
+    emblib::rtos::profiled_lock<emblib::rtos::rw_spinlock, true> lock;
+    {
+        emblib::rtos::shared_lock reader1(lock);
+        emblib::rtos::shared_lock reader2(lock);
+        REQUIRE_FALSE(lock.try_lock());
+        REQUIRE(lock.try_lock_shared());
+        lock.unlock_shared();
+    }
+    {
+        emblib::rtos::scoped_lock writer(lock);
+        REQUIRE_FALSE(lock.try_lock_shared());
+    }
+
+    // Only exclusive locking is recorded
+    REQUIRE(lock.get_wait_time().get_count() == 1);
+    REQUIRE(lock.get_hold_time().get_count() == 1);
+}
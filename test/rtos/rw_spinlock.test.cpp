@@ -0,0 +1,107 @@
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/rw_spinlock.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("RW spinlock", "[rtos][rw_spinlock]")
+{
+    emblib::rtos::rw_spinlock l;
+
+    SECTION("Readers share the lock")
+    {
+        REQUIRE(l.try_lock_shared());
+        REQUIRE(l.try_lock_shared());
+        REQUIRE_FALSE(l.try_lock());
+
+        l.unlock_shared();
+        REQUIRE_FALSE(l.try_lock());
+        l.unlock_shared();
+        REQUIRE(l.try_lock());
+        l.unlock();
+    }
+
+    SECTION("Writer excludes everyone")
+    {
+        REQUIRE(l.try_lock());
+        REQUIRE_FALSE(l.try_lock());
+        REQUIRE_FALSE(l.try_lock_shared());
+
+        l.unlock();
+        REQUIRE(l.try_lock_shared());
+        l.unlock_shared();
+    }
+
+    SECTION("Scoped guards")
+    {
+        {
+            emblib::rtos::shared_lock lock(l);
+            REQUIRE_FALSE(l.try_lock());
+        }
+        {
+            emblib::rtos::scoped_lock lock(l);
+            REQUIRE_FALSE(l.try_lock_shared());
+        }
+        REQUIRE(l.try_lock());
+        l.unlock();
+    }
+}
+
+TEST_CASE("RW spinlock waiting writer blocks new readers", "[rtos][rw_spinlock]")
+{
+    emblib::rtos::rw_spinlock l;
+    std::atomic<bool> has_written(false);
+
+    l.lock_shared();
+    std::thread writer([&] {
+        emblib::rtos::scoped_lock lock(l);
+        has_written = true;
+    });
+
+    // Once the writer is waiting, readers are turned away
+    while (l.try_lock_shared()) {
+        l.unlock_shared();
+        std::this_thread::yield();
+    }
+    REQUIRE_FALSE(has_written);
+
+    l.unlock_shared();
+    writer.join();
+    REQUIRE(has_written);
+}
+
+TEST_CASE("RW spinlock readers and writers", "[rtos][rw_spinlock]")
+{
+    constexpr size_t WRITE_COUNT = 10000;
+
+    emblib::rtos::rw_spinlock l;
+    // Written as a pair, readers must always see equal values
+    size_t first = 0;
+    size_t second = 0;
+    std::atomic<bool> is_torn(false);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < 2; t++) {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < WRITE_COUNT; i++) {
+                emblib::rtos::scoped_lock lock(l);
+                first++;
+                second++;
+            }
+        });
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < WRITE_COUNT; i++) {
+                emblib::rtos::shared_lock lock(l);
+                if (first != second)
+                    is_torn = true;
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE_FALSE(is_torn);
+    REQUIRE(first == 2 * WRITE_COUNT);
+}
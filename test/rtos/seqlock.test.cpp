@@ -0,0 +1,83 @@
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/seqlock.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct gains_s {
+    float kp;
+    float ki;
+    float kd;
+};
+
+}
+
+TEST_CASE("Seqlock", "[rtos][seqlock]")
+{
+    emblib::rtos::seqlock<gains_s> gains({1, 2, 3});
+
+    REQUIRE(gains.read().kp == 1);
+    REQUIRE(gains.get_write_count() == 0);
+
+    SECTION("Write")
+    {
+        gains.write({4, 5, 6});
+        REQUIRE(gains.read().kd == 6);
+        REQUIRE(gains.get_write_count() == 1);
+    }
+
+    SECTION("Modify in place")
+    {
+        const gains_s initial = gains.read();
+        const size_t write_count = gains.get_write_count();
+        {
+            emblib::rtos::scoped_lock lock(gains);
+            gains.get().ki = 10;
+
+            gains_s buffer;
+            REQUIRE_FALSE(gains.try_read(buffer));
+            REQUIRE_FALSE(gains.try_lock());
+        }
+
+        const gains_s value = gains.read();
+        REQUIRE(value.kp == initial.kp);
+        REQUIRE(value.ki == 10);
+        REQUIRE(gains.get_write_count() == write_count + 1);
+    }
+}
+
+TEST_CASE("Seqlock concurrent writers and readers", "[rtos][seqlock]")
+{
+    constexpr size_t WRITE_COUNT = 10000;
+
+    emblib::rtos::seqlock<gains_s> gains({0, 0, 0});
+    std::atomic<bool> is_torn(false);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < 2; t++) {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < WRITE_COUNT; i++) {
+                emblib::rtos::scoped_lock lock(gains);
+                gains.get().kp += 1;
+                gains.get().kd = gains.get().kp;
+            }
+        });
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < WRITE_COUNT; i++) {
+                const gains_s value = gains.read();
+                if (value.kp != value.kd)
+                    is_torn = true;
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE_FALSE(is_torn);
+    REQUIRE(gains.read().kp == 2 * WRITE_COUNT);
+    REQUIRE(gains.get_write_count() == 2 * WRITE_COUNT);
+}
@@ -26,4 +26,4 @@ TEST_CASE("Spinlock scoped lock", "[rtos][spinlock]")
 
     REQUIRE(s1.try_lock());
     REQUIRE(s2.try_lock());
-}
\ No newline at end of file
+}
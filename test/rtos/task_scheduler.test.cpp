@@ -0,0 +1,82 @@
+#include "emblib/rtos/task_scheduler.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Task scheduler test", "[rtos][task_scheduler]")
+{
+    using scheduler_t = emblib::rtos::task_scheduler<2, 16>;
+    scheduler_t scheduler;
+    size_t counter = 0;
+
+    auto increment = [&counter] { counter++; };
+    REQUIRE(scheduler.get_worker_index() == scheduler_t::NO_WORKER);
+    for (size_t i = 0; i < 4; i++) {
+        REQUIRE(scheduler.submit(increment));
+    }
+    REQUIRE(scheduler.get_task_count() == 4);
+
+    // Without workers the caller executes the queued tasks while waiting
+    size_t range_sum = 0;
+    auto sum_range = [&range_sum](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            range_sum += i;
+        }
+    };
+    scheduler.parallel_for(0, 100, 10, sum_range);
+
+    REQUIRE(range_sum == 4950);
+    REQUIRE(counter == 4);
+    REQUIRE(scheduler.get_task_count() == 0);
+
+    // Chunks which don't fit in the task pool are processed inline
+    for (size_t i = 0; i < 16; i++) {
+        REQUIRE(scheduler.submit(increment));
+    }
+    REQUIRE_FALSE(scheduler.submit(increment));
+
+    range_sum = 0;
+    scheduler.parallel_for(0, 100, 3, sum_range);
+    REQUIRE(range_sum == 4950);
+    REQUIRE(counter == 4);
+}
+
+TEST_CASE("Task scheduler parallel for", "[rtos][task_scheduler]")
+{
+    constexpr size_t WORKER_COUNT = 3;
+    constexpr size_t ITEM_COUNT = 10000;
+    emblib::rtos::task_scheduler<WORKER_COUNT, 64, 64> scheduler;
+
+    auto idle = [] { std::this_thread::yield(); };
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < WORKER_COUNT; i++) {
+        workers.emplace_back([&scheduler, &idle, i] {
+            scheduler.run(i, idle);
+        });
+    }
+
+    std::vector<std::atomic<uint32_t>> visits(ITEM_COUNT);
+    auto visit = [&visits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            visits[i]++;
+        }
+    };
+
+    // Nested loops are scheduled on the worker deques and stolen by the others
+    auto visit_nested = [&scheduler, &visit](size_t begin, size_t end) {
+        scheduler.parallel_for(begin * 100, end * 100, 7, visit);
+    };
+    scheduler.parallel_for(0, ITEM_COUNT / 100, 1, visit_nested);
+    scheduler.parallel_for(0, ITEM_COUNT, 13, visit);
+
+    scheduler.stop();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < ITEM_COUNT; i++) {
+        REQUIRE(visits[i] == 2);
+    }
+    REQUIRE(scheduler.get_task_count() == 0);
+}
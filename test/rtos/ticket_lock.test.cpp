@@ -0,0 +1,37 @@
+#include "emblib/rtos/lock.hpp"
+#include "emblib/rtos/ticket_lock.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("Ticket lock", "[rtos][ticket_lock]")
+{
+    emblib::rtos::ticket_lock l;
+
+    REQUIRE(l.try_lock());
+    REQUIRE_FALSE(l.try_lock());
+
+    l.unlock();
+    l.lock();
+    REQUIRE_FALSE(l.try_lock());
+
+    l.unlock();
+    REQUIRE(l.try_lock());
+    l.unlock();
+}
+
+TEST_CASE("Ticket lock scoped lock", "[rtos][ticket_lock]")
+{
+    emblib::rtos::ticket_lock l1, l2;
+
+    {
+        emblib::rtos::scoped_lock lock(l1, l2);
+
+        REQUIRE_FALSE(l1.try_lock());
+        REQUIRE_FALSE(l2.try_lock());
+    }
+
+    REQUIRE(l1.try_lock());
+    REQUIRE(l2.try_lock());
+    // Release in the same order as acquired
+    l1.unlock();
+    l2.unlock();
+}
@@ -0,0 +1,104 @@
+#include "emblib/rtos/timer_wheel.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("Timer wheel test", "[rtos][timer_wheel]")
+{
+    emblib::rtos::timer_wheel<4> wheel;
+    size_t fired = 0;
+    auto on_expire = [&fired] { fired++; };
+
+    auto timer = wheel.start(3, on_expire);
+    REQUIRE(timer.is_valid());
+    REQUIRE(wheel.is_running(timer));
+
+    wheel.advance(2);
+    REQUIRE(fired == 0);
+    wheel.advance();
+    REQUIRE(fired == 1);
+    REQUIRE_FALSE(wheel.is_running(timer));
+    REQUIRE_FALSE(wheel.cancel(timer));
+
+    // Canceled timer never fires
+    timer = wheel.start(2, on_expire);
+    REQUIRE(wheel.cancel(timer));
+    REQUIRE_FALSE(timer.is_valid());
+    wheel.advance(5);
+    REQUIRE(fired == 1);
+
+    // Fixed capacity
+    for (size_t i = 0; i < wheel.get_capacity(); i++) {
+        REQUIRE(wheel.start(10, on_expire).is_valid());
+    }
+    REQUIRE_FALSE(wheel.start(10, on_expire).is_valid());
+    wheel.advance(10);
+    REQUIRE(fired == 5);
+    REQUIRE(wheel.get_timer_count() == 0);
+}
+
+TEST_CASE("Timer wheel periodic timer", "[rtos][timer_wheel]")
+{
+    emblib::rtos::timer_wheel<4> wheel;
+    std::vector<uint64_t> times;
+    emblib::rtos::timer_wheel<4>::handle timer;
+
+    auto on_expire = [&] {
+        times.push_back(wheel.get_time());
+        if (times.size() == 3)
+            wheel.cancel(timer);
+    };
+    timer = wheel.start(5, on_expire, 100);
+
+    wheel.advance(1000);
+    REQUIRE(times == std::vector<uint64_t>{5, 105, 205});
+    REQUIRE(wheel.get_timer_count() == 0);
+}
+
+TEST_CASE("Timer wheel deadlines across levels", "[rtos][timer_wheel]")
+{
+    // Small wheel, so deadlines quickly span every level and the clamped range
+    constexpr size_t TIMER_COUNT = 200;
+    emblib::rtos::timer_wheel<TIMER_COUNT, 2, 3> wheel;
+
+    std::vector<uint64_t> deadlines(TIMER_COUNT);
+    std::vector<uint64_t> fired_at(TIMER_COUNT, 0);
+    struct context_s {
+        emblib::rtos::timer_wheel<TIMER_COUNT, 2, 3>& wheel;
+        uint64_t& fired_at;
+        void operator()() { fired_at = wheel.get_time(); }
+    };
+    std::vector<context_s> contexts;
+    contexts.reserve(TIMER_COUNT);
+
+    wheel.advance(7);
+    for (size_t i = 0; i < TIMER_COUNT; i++) {
+        const uint64_t delay = 1 + (i * 37) % 150;
+        deadlines[i] = wheel.get_time() + delay;
+        contexts.push_back({wheel, fired_at[i]});
+        REQUIRE(wheel.start(delay, contexts[i]).is_valid());
+    }
+
+    wheel.advance(200);
+    REQUIRE(fired_at == deadlines);
+}
+
+TEST_CASE("Timer wheel cancel from callback", "[rtos][timer_wheel]")
+{
+    emblib::rtos::timer_wheel<4> wheel;
+    emblib::rtos::timer_wheel<4>::handle first, second;
+    size_t fired = 0;
+
+    // Both timers expire at the same tick, and whichever fires first cancels the other
+    auto cancel_other = [&] {
+        fired++;
+        wheel.cancel(first);
+        wheel.cancel(second);
+    };
+    first = wheel.start(4, cancel_other);
+    second = wheel.start(4, cancel_other);
+
+    wheel.advance(4);
+    REQUIRE(fired == 1);
+    REQUIRE(wheel.get_timer_count() == 0);
+}